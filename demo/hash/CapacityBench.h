@@ -0,0 +1,103 @@
+/*
+ * File:   CapacityBench.h
+ *
+ * Benchmarks: xMap capacity management
+ *  + bulk load of n keys: growth by rehash (default) against reserve(n)
+ *  + mass removal down to 1% of the keys: table size and resident memory
+ *      without shrinking, with setShrinkLoad (auto-shrink) and with shrink_to_fit
+ */
+
+#ifndef CAPACITYBENCH_H
+#define CAPACITYBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include "hash/xMap.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+// resident set size of the process, in MB (Linux: /proc/self/statm)
+double residentMB()
+{
+    long pages = 0, resident = 0;
+    ifstream statm("/proc/self/statm");
+    statm >> pages >> resident;
+    return resident * (double)sysconf(_SC_PAGESIZE) / (1 << 20);
+}
+
+double tableMB(xMap<int, int> &map)
+{
+    return map.getCapacity() * (double)sizeof(IntrusiveList<xMap<int, int>::Entry>) / (1 << 20);
+}
+
+/*
+ * capacityLoadCase: put keys 0 .. n-1; a rehash is counted each time the capacity changes
+ */
+void capacityLoadCase(string name, int n, bool reserve)
+{
+    xMap<int, int> map(&xMap<int, int>::intKeyHash);
+    Stopwatch sw;
+    if (reserve)
+        map.reserve(n);
+    int rehashes = 0, capacity = map.getCapacity();
+    for (int key = 0; key < n; key++)
+    {
+        map.put(key, key);
+        if (map.getCapacity() != capacity)
+        {
+            rehashes++;
+            capacity = map.getCapacity();
+        }
+    }
+    double ms = sw.millis();
+    benchRow(name, ms, n);
+    cout << "    rehashes: " << rehashes << ", capacity: " << map.getCapacity() << endl;
+}
+
+/*
+ * capacityShrinkCase: put n keys, remove all but n / 100 of them, then report
+ *  the table size and the resident memory (relative to the start of the case)
+ *  mode: 0 no shrink, 1 setShrinkLoad(0.1), 2 shrink_to_fit() after the removes
+ */
+void capacityShrinkCase(string name, int n, int mode)
+{
+    double baseMB = residentMB();
+    {
+        xMap<int, int> map(&xMap<int, int>::intKeyHash);
+        if (mode == 1)
+            map.setShrinkLoad(0.1f);
+        for (int key = 0; key < n; key++)
+            map.put(key, key);
+        double fullMB = residentMB() - baseMB, fullTable = tableMB(map);
+
+        Stopwatch sw;
+        for (int key = n / 100; key < n; key++)
+            map.remove(key);
+        if (mode == 2)
+            map.shrink_to_fit();
+        benchRow(name + ": remove 99%", sw.millis(), n - n / 100);
+        cout << fixed << setprecision(1)
+             << "    full:  table " << setw(7) << right << fullTable << " MB, resident +"
+             << setw(7) << right << fullMB << " MB" << endl
+             << "    after: table " << setw(7) << right << tableMB(map) << " MB, resident +"
+             << setw(7) << right << residentMB() - baseMB << " MB, capacity "
+             << map.getCapacity() << " for " << map.size() << " keys" << endl;
+    }
+}
+
+void capacityBench(int n = 1000000)
+{
+    cout << "-- bulk load, n = " << n << endl;
+    capacityLoadCase("grow by rehash", n, false);
+    capacityLoadCase("reserve(n)", n, true);
+
+    cout << "-- mass remove, n = " << n << endl;
+    capacityShrinkCase("no shrink", n, 0);
+    capacityShrinkCase("setShrinkLoad(0.1)", n, 1);
+    capacityShrinkCase("shrink_to_fit()", n, 2);
+}
+
+#endif /* CAPACITYBENCH_H */
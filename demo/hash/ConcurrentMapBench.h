@@ -0,0 +1,113 @@
+/*
+ * File:   ConcurrentMapBench.h
+ *
+ * Benchmarks: throughput of ConcurrentMap<K, V> (1 and 16 shards) against an xMap
+ *  behind one mutex, read-heavy and write-heavy, with 1 .. maxThreads threads
+ */
+
+#ifndef CONCURRENTMAPBENCH_H
+#define CONCURRENTMAPBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "hash/xMap.h"
+#include "hash/ConcurrentMap.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+/*
+ * LockedXMap: the baseline, every operation takes the same mutex
+ */
+class LockedXMap
+{
+private:
+    mutex lock;
+    xMap<int, int> map;
+
+public:
+    LockedXMap() : map(&xMap<int, int>::intKeyHash)
+    {
+        map.setPowerOfTwo(true);
+    }
+    void put(int key, int value)
+    {
+        lock_guard<mutex> guard(lock);
+        map.put(key, value);
+    }
+    bool tryGet(int key, int &value)
+    {
+        lock_guard<mutex> guard(lock);
+        if (!map.containsKey(key))
+            return false;
+        value = map.get(key);
+        return true;
+    }
+    bool remove(int key, int value)
+    {
+        lock_guard<mutex> guard(lock);
+        return map.remove(key, value);
+    }
+};
+
+/*
+ * concurrentMapBenchCase: "keys" keys are put first, then each thread runs its share of
+ *  "nops" random operations on 2 * keys keys:
+ *  readPercent% tryGet, the rest split evenly between put and remove
+ */
+template <class M>
+void concurrentMapBenchCase(string name, M &map, int keys, int nthreads, int readPercent, long long nops)
+{
+    for (int key = 0; key < keys; key++)
+        map.put(key, key);
+
+    vector<thread> threads;
+    long long sums[64] = {0};
+    Stopwatch sw;
+    for (int t = 0; t < nthreads; t++)
+        threads.push_back(thread([&, t]() {
+            mt19937 gen(t + 1);
+            long long sum = 0;
+            for (long long i = 0; i < nops / nthreads; i++)
+            {
+                int key = gen() % (2 * keys), op = gen() % 100, value;
+                if (op < readPercent)
+                    sum += map.tryGet(key, value);
+                else if (op % 2 == 0)
+                    map.put(key, key);
+                else
+                    sum += map.remove(key, key);
+            }
+            sums[t * 8 % 64] = sum;
+        }));
+    for (thread &th : threads)
+        th.join();
+    benchRow(name + ", " + to_string(nthreads) + " threads", sw.millis(), nops);
+    benchKeep(sums[0]);
+}
+
+void concurrentMapBenchLoad(string title, int readPercent, int maxThreads, long long nops)
+{
+    int keys = 1 << 14;
+    cout << "-- " << title << " (" << readPercent << "% reads, " << keys << " keys)" << endl;
+    for (int nthreads = 1; nthreads <= maxThreads; nthreads *= 2)
+    {
+        LockedXMap locked;
+        concurrentMapBenchCase("xMap + mutex", locked, keys, nthreads, readPercent, nops);
+        ConcurrentMap<int, int> single(&xMap<int, int>::intKeyHash, 0.75f, 0, 0, 0, 0, 1);
+        concurrentMapBenchCase("ConcurrentMap, 1 shard", single, keys, nthreads, readPercent, nops);
+        ConcurrentMap<int, int> sharded(&xMap<int, int>::intKeyHash, 0.75f, 0, 0, 0, 0, 16);
+        concurrentMapBenchCase("ConcurrentMap, 16 shards", sharded, keys, nthreads, readPercent, nops);
+    }
+}
+
+void concurrentMapBench(int maxThreads = 8, long long nops = 2000000)
+{
+    concurrentMapBenchLoad("read-heavy", 95, maxThreads, nops);
+    concurrentMapBenchLoad("write-heavy", 20, maxThreads, nops);
+}
+
+#endif /* CONCURRENTMAPBENCH_H */
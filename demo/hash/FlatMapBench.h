@@ -0,0 +1,89 @@
+/*
+ * File:   FlatMapBench.h
+ *
+ * Benchmarks: FlatMap<K, V> (open addressing) against xMap<K, V> (separate chaining)
+ *  on insert, lookup (hit and miss) and erase, for 10^3 .. maxKeys keys
+ */
+
+#ifndef FLATMAPBENCH_H
+#define FLATMAPBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include "hash/xMap.h"
+#include "hash/FlatMap.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+int flatBenchIntHash(int &key, int tableSize)
+{
+    // non-negative keys only
+    return key % tableSize;
+}
+
+/*
+ * flatMapBenchCase: n distinct random keys
+ *  + insert: put all keys
+ *  + hit: get every key (in another random order)
+ *  + miss: containsKey on n keys that are not in the map
+ *  + erase: remove every key
+ */
+template <class M>
+void flatMapBenchCase(string name, vector<int> &keys, vector<int> &misses)
+{
+    int n = keys.size();
+    M map(&flatBenchIntHash);
+    long long sum = 0;
+
+    Stopwatch sw;
+    for (int i = 0; i < n; i++)
+        map.put(keys[i], i);
+    benchRow(name + ": insert", sw.millis(), n);
+
+    sw.reset();
+    for (int i = n - 1; i >= 0; i--)
+        sum += map.get(keys[i]);
+    benchRow(name + ": lookup hit", sw.millis(), n);
+
+    sw.reset();
+    for (int i = 0; i < n; i++)
+        sum += map.containsKey(misses[i]);
+    benchRow(name + ": lookup miss", sw.millis(), n);
+
+    sw.reset();
+    for (int i = 0; i < n; i++)
+        sum += map.remove(keys[i]);
+    benchRow(name + ": erase", sw.millis(), n);
+    benchKeep(sum);
+}
+
+/*
+ * flatMapBench(maxKeys, xMapMaxKeys): xMap is only run up to xMapMaxKeys
+ *  (a chained table of 10^7 keys needs about 1 GB)
+ */
+void flatMapBench(int maxKeys = 10000000, int xMapMaxKeys = 10000000)
+{
+    for (int n = 1000; n <= maxKeys; n *= 10)
+    {
+        // even keys are stored, odd keys are misses
+        mt19937 gen(n);
+        vector<int> keys(n), misses(n);
+        for (int i = 0; i < n; i++)
+        {
+            keys[i] = 2 * i;
+            misses[i] = 2 * i + 1;
+        }
+        shuffle(keys.begin(), keys.end(), gen);
+        shuffle(misses.begin(), misses.end(), gen);
+
+        cout << "-- n = " << n << endl;
+        if (n <= xMapMaxKeys)
+            flatMapBenchCase<xMap<int, int>>("xMap", keys, misses);
+        flatMapBenchCase<FlatMap<int, int>>("FlatMap", keys, misses);
+    }
+}
+
+#endif /* FLATMAPBENCH_H */
@@ -0,0 +1,59 @@
+/*
+ * File:   FrozenMapBench.h
+ *
+ * Benchmarks: start-up and lookups of a static vocabulary (word -> index)
+ *  + built at start-up, one put per word, into an xMap
+ *  + frozen once to a file, then opened (mmap) at start-up as a FrozenMap
+ *
+ * Uses the allocation counter of KeyLookupBench.h: include this header in one
+ *  translation unit only, and not together with KeyLookupBench.h.
+ */
+
+#ifndef FROZENMAPBENCH_H
+#define FROZENMAPBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include "hash/xMap.h"
+#include "hash/FrozenMap.h"
+#include "hash/KeyLookupBench.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+void frozenMapBench(int n = 1000000, string filename = "/tmp/frozen_vocab.map")
+{
+    vector<string> words(n);
+    for (int i = 0; i < n; i++)
+        words[i] = "vocab_word_" + to_string(i);
+
+    cout << "-- start-up, n = " << n << " words" << endl;
+    Stopwatch sw;
+    xMap<string, int> vocab(&xMap<string, int>::stringKeyHash);
+    vocab.setPowerOfTwo(true);
+    for (int i = 0; i < n; i++)
+        vocab.put(words[i], i);
+    benchRow("build xMap (put per word)", sw.millis(), n);
+
+    sw.reset();
+    FrozenMap<string, int>::freeze(vocab, filename);
+    benchRow("freeze to file (once)", sw.millis(), n);
+
+    sw.reset();
+    {
+        FrozenMap<string, int> frozen(filename);
+        benchKeep(frozen.get(words[0]));
+        benchRow("open FrozenMap + first get", sw.millis(), 1);
+
+        cout << "-- lookups, every word 10 times" << endl;
+        keyLookupCase("xMap get(const string&)", n, 10, [&](int i) { return vocab.get(words[i]); });
+        keyLookupCase("FrozenMap get(const string&)", n, 10, [&](int i) { return frozen.get(words[i]); });
+        keyLookupCase("FrozenMap get(const char*)", n, 10, [&](int i) { return frozen.get(words[i].c_str()); });
+        keyLookupCase("FrozenMap containsKey(miss)", n, 10, [&](int i) { return (int)frozen.containsKey(words[i].c_str() + 1); });
+    }
+    remove(filename.c_str());
+}
+
+#endif /* FROZENMAPBENCH_H */
@@ -0,0 +1,139 @@
+/*
+ * File:   HashQualityBench.h
+ *
+ * Benchmarks: distribution and speed of the hash functions in hash/HashFunctions.h,
+ *  measured with xMap::clashes() (the size of every bucket)
+ */
+
+#ifndef HASHQUALITYBENCH_H
+#define HASHQUALITYBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "hash/xMap.h"
+#include "hash/HashFunctions.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+/*
+ * hashQualityRow: put all keys into an xMap using "hash", then summarize clashes():
+ *  + used: non-empty buckets; max: largest bucket
+ *  + colliding: keys that share their bucket with an earlier key (sum of size - 1)
+ *  + probes: average bucket size seen by a successful lookup (1.0 is ideal)
+ */
+template <class K>
+void hashQualityRow(string name, vector<K> &keys, int (*hash)(K &, int))
+{
+    xMap<K, int> map(hash);
+    for (int i = 0; i < (int)keys.size(); i++)
+        map.put(keys[i], i);
+
+    long long used = 0, maxSize = 0, colliding = 0, probes = 0;
+    DLinkedList<int> sizes = map.clashes();
+    for (int size : sizes)
+    {
+        if (size > 0)
+            used++;
+        if (size > 1)
+            colliding += size - 1;
+        maxSize = max(maxSize, (long long)size);
+        probes += (long long)size * (size + 1) / 2;
+    }
+    cout << setw(18) << left << name
+         << setw(10) << right << map.getCapacity()
+         << setw(10) << right << used
+         << setw(8) << right << maxSize
+         << setw(12) << right << colliding
+         << setw(10) << right << fixed << setprecision(2) << (double)probes / keys.size() << endl;
+}
+
+void hashQualityHeader(string title, int nkeys)
+{
+    cout << "-- " << title << " (" << nkeys << " keys)" << endl;
+    cout << setw(18) << left << "hash"
+         << setw(10) << right << "buckets"
+         << setw(10) << right << "used"
+         << setw(8) << right << "max"
+         << setw(12) << right << "colliding"
+         << setw(10) << right << "probes" << endl;
+}
+
+void hashQualityStrings(string title, vector<string> &keys)
+{
+    hashQualityHeader(title, keys.size());
+    hashQualityRow<string>("sumStringHash", keys, &sumStringHash);
+    hashQualityRow<string>("fnv1aStringHash", keys, &fnv1aStringHash);
+    hashQualityRow<string>("wyStringHash", keys, &wyStringHash);
+}
+
+void hashQualityInts(string title, vector<int> &keys)
+{
+    hashQualityHeader(title, keys.size());
+    hashQualityRow<int>("moduloIntHash", keys, &moduloIntHash);
+    hashQualityRow<int>("mixIntHash", keys, &mixIntHash);
+}
+
+/*
+ * hashSpeedBench: raw hashing cost per key (no map)
+ */
+void hashSpeedBench(vector<string> &keys)
+{
+    int rounds = 100;
+    long long sum = 0;
+    int (*hashes[])(string &, int) = {&sumStringHash, &fnv1aStringHash, &wyStringHash};
+    string names[] = {"sumStringHash", "fnv1aStringHash", "wyStringHash"};
+    for (int h = 0; h < 3; h++)
+    {
+        Stopwatch sw;
+        for (int r = 0; r < rounds; r++)
+            for (int i = 0; i < (int)keys.size(); i++)
+                sum += hashes[h](keys[i], 1000003);
+        benchRow(names[h], sw.millis(), (long long)keys.size() * rounds);
+    }
+    benchKeep(sum);
+}
+
+void hashQualityBench()
+{
+    // parameter names as used by the optimizers and the config file
+    vector<string> config;
+    string kinds[] = {"W", "b", "gamma", "beta", "mW", "vW", "mb", "vb"};
+    for (int layer = 0; layer < 500; layer++)
+        for (string kind : kinds)
+        {
+            config.push_back("FC_" + to_string(layer) + "_" + kind);
+            config.push_back("layer" + to_string(layer) + "." + kind);
+        }
+    hashQualityStrings("config-like keys", config);
+
+    // all permutations of a few words: the character sums are equal
+    vector<string> anagrams;
+    string words[] = {"abcdefg", "listen!", "hashmap"};
+    for (string word : words)
+    {
+        sort(word.begin(), word.end());
+        do
+            anagrams.push_back(word);
+        while (next_permutation(word.begin(), word.end()) && anagrams.size() % 3000 != 0);
+    }
+    hashQualityStrings("anagrams", anagrams);
+
+    // after 10000 puts the table has 14053 = 13 * 23 * 47 buckets:
+    //  with "key % capacity", keys sharing the factor 13 * 23 land in 47 buckets only
+    vector<int> sequential, strided;
+    for (int i = 0; i < 10000; i++)
+    {
+        sequential.push_back(i);
+        strided.push_back(i * 299);
+    }
+    hashQualityInts("sequential ints", sequential);
+    hashQualityInts("ints with stride 299", strided);
+
+    cout << "-- hashing speed (config-like keys)" << endl;
+    hashSpeedBench(config);
+}
+
+#endif /* HASHQUALITYBENCH_H */
@@ -0,0 +1,80 @@
+/*
+ * File:   HashStatsBench.h
+ *
+ * Benchmarks: cost of xMap::enableStats on put/get, and the stats of the same keys
+ *  under two hash functions (text and JSON export)
+ */
+
+#ifndef HASHSTATSBENCH_H
+#define HASHSTATSBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "hash/xMap.h"
+#include "hash/HashFunctions.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+/*
+ * hashStatsCostCase: put n shuffled keys, then get each of them
+ */
+void hashStatsCostCase(string name, vector<int> &keys, bool stats)
+{
+    int n = keys.size();
+    long long sum = 0;
+    xMap<int, int> map(&xMap<int, int>::intKeyHash);
+    map.enableStats(stats);
+
+    Stopwatch sw;
+    for (int i = 0; i < n; i++)
+        map.put(keys[i], i);
+    benchRow(name + ": put", sw.millis(), n);
+    sw.reset();
+    for (int i = n - 1; i >= 0; i--)
+        sum += map.get(keys[i]);
+    benchRow(name + ": get", sw.millis(), n);
+    benchKeep(sum);
+}
+
+void hashStatsReport(string name, vector<string> &keys, int (*hash)(string &, int), bool json)
+{
+    xMap<string, int> map(hash);
+    map.enableStats();
+    for (int i = 0; i < (int)keys.size(); i++)
+        map.put(keys[i], i);
+    for (int i = 0; i < (int)keys.size(); i++)
+        benchKeep(map.get(keys[i]));
+    cout << "-- " << name << endl;
+    if (json)
+        cout << map.getStats().toJSON() << endl;
+    else
+        cout << map.getStats().toString();
+}
+
+void hashStatsBench(int n = 1000000)
+{
+    mt19937 gen(n);
+    vector<int> keys(n);
+    for (int i = 0; i < n; i++)
+        keys[i] = i;
+    shuffle(keys.begin(), keys.end(), gen);
+    cout << "-- cost of the stats, n = " << n << endl;
+    hashStatsCostCase("stats off", keys, false);
+    hashStatsCostCase("stats on", keys, true);
+
+    // parameter names as in HashQualityBench
+    vector<string> config;
+    string kinds[] = {"W", "b", "gamma", "beta", "mW", "vW", "mb", "vb"};
+    for (int layer = 0; layer < 500; layer++)
+        for (string kind : kinds)
+            config.push_back("FC_" + to_string(layer) + "_" + kind);
+    hashStatsReport("config-like keys, sumStringHash", config, &sumStringHash, false);
+    hashStatsReport("config-like keys, wyStringHash", config, &wyStringHash, false);
+    hashStatsReport("config-like keys, wyStringHash (JSON)", config, &wyStringHash, true);
+}
+
+#endif /* HASHSTATSBENCH_H */
@@ -0,0 +1,123 @@
+/*
+ * File:   KeyLookupBench.h
+ *
+ * Benchmarks: heap allocations and time per lookup in xMap<string, int> and
+ *  FlatMap<string, int>, by string (const K&), by const char* and by string_view
+ *  (key views), and by view without a view hash (a temporary string is built)
+ *
+ * The allocations are counted by replacing the global operator new/delete:
+ *  include this header in one translation unit only.
+ */
+
+#ifndef KEYLOOKUPBENCH_H
+#define KEYLOOKUPBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <new>
+#include <stdlib.h>
+#include "hash/xMap.h"
+#include "hash/FlatMap.h"
+#include "hash/HashFunctions.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+static long long g_benchAllocations = 0;
+
+// operator delete frees what this operator new got from malloc: the pairing is right
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(size_t size)
+{
+    g_benchAllocations++;
+    void *ptr = malloc(size == 0 ? 1 : size);
+    if (ptr == 0)
+        throw bad_alloc();
+    return ptr;
+}
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+void operator delete(void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+// the hook of the application, e.g. stringHash in ann/functions.cpp: no view hash is known
+int lookupBenchHash(string &key, int tableSize)
+{
+    return wyStringHash(key, tableSize);
+}
+
+/*
+ * keyLookupCase: "rounds" passes over all keys, lookup(i) looks up key i;
+ *  prints the time and the allocations per lookup
+ */
+template <class Lookup>
+void keyLookupCase(string name, int nkeys, int rounds, Lookup lookup)
+{
+    long long sum = 0, nops = (long long)nkeys * rounds;
+    long long allocations = g_benchAllocations;
+    Stopwatch sw;
+    for (int r = 0; r < rounds; r++)
+        for (int i = 0; i < nkeys; i++)
+            sum += lookup(i);
+    double ms = sw.millis();
+    allocations = g_benchAllocations - allocations;
+    benchKeep(sum);
+    cout << setw(36) << left << name
+         << setw(12) << right << fixed << setprecision(2) << ms << " ms"
+         << setw(12) << right << fixed << setprecision(1) << ms * 1e6 / nops << " ns/op"
+         << setw(10) << right << fixed << setprecision(2) << (double)allocations / nops << " allocs/op" << endl;
+}
+
+template <class M>
+void keyLookupMap(string title, M &map, vector<string> &keys, int rounds)
+{
+    int n = keys.size();
+    vector<const char *> cstrs(n);
+    vector<string_view> views(n);
+    for (int i = 0; i < n; i++)
+    {
+        map.put(keys[i], i);
+        cstrs[i] = keys[i].c_str();
+        views[i] = keys[i];
+    }
+    cout << "-- " << title << " (" << n << " keys of " << keys[0].length() << "+ chars)" << endl;
+    keyLookupCase("get(const string&)", n, rounds, [&](int i) { return map.get(keys[i]); });
+    keyLookupCase("get(const char*)", n, rounds, [&](int i) { return map.get(cstrs[i]); });
+    keyLookupCase("get(string_view)", n, rounds, [&](int i) { return map.get(views[i]); });
+    keyLookupCase("containsKey(const char*)", n, rounds, [&](int i) { return (int)map.containsKey(cstrs[i]); });
+}
+
+void keyLookupBench(int nkeys = 10000, int rounds = 100)
+{
+    // longer than the small-string buffer (15 chars): every temporary string allocates
+    vector<string> keys;
+    for (int i = 0; i < nkeys; i++)
+        keys.push_back("encoder.layer_" + to_string(i) + ".weight");
+
+    xMap<string, int> xmap(&xMap<string, int>::stringKeyHash);
+    keyLookupMap("xMap, stringKeyHash", xmap, keys, rounds);
+    FlatMap<string, int> flat(&wyStringHash);
+    keyLookupMap("FlatMap, wyStringHash", flat, keys, rounds);
+
+    // an unknown hook: views fall back to a temporary string until setViewHash
+    xMap<string, int> custom(&lookupBenchHash);
+    keyLookupMap("xMap, hook without view hash", custom, keys, rounds);
+    custom.setViewHash(&wyViewHash);
+    cout << "-- after setViewHash(&wyViewHash)" << endl;
+    keyLookupCase("get(const char*)", nkeys, rounds, [&](int i) { return custom.get(keys[i].c_str()); });
+}
+
+#endif /* KEYLOOKUPBENCH_H */
@@ -0,0 +1,90 @@
+/*
+ * File:   RehashBench.h
+ *
+ * Benchmarks: cost of xMap::rehash with the default indexing (capacity * 1.5,
+ *  hashCode called again for every key) against setPowerOfTwo(true)
+ *  (capacity * 2, cached hash, index = hash & mask)
+ */
+
+#ifndef REHASHBENCH_H
+#define REHASHBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "hash/xMap.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+/*
+ * RehashBenchMap: xMap with access to the protected growth path
+ *  + timeRehash: one rehash to newCapacity
+ */
+template <class K>
+class RehashBenchMap : public xMap<K, int>
+{
+public:
+    RehashBenchMap(int (*hashCode)(K &, int), bool powerOfTwo) : xMap<K, int>(hashCode)
+    {
+        this->setPowerOfTwo(powerOfTwo);
+    }
+    double timeRehash(int newCapacity)
+    {
+        Stopwatch sw;
+        this->rehash(newCapacity);
+        return sw.millis();
+    }
+};
+
+/*
+ * rehashBenchCase:
+ *  + fill: insert all keys, including every rehash on the way
+ *  + rehash: the table is grown to the next capacity and shrunk back, "rounds" times
+ */
+template <class K>
+void rehashBenchCase(string name, vector<K> &keys, int (*hashCode)(K &, int), bool powerOfTwo)
+{
+    int n = keys.size(), rounds = 5;
+    RehashBenchMap<K> map(hashCode, powerOfTwo);
+
+    Stopwatch sw;
+    for (int i = 0; i < n; i++)
+        map.put(keys[i], i);
+    benchRow(name + ": fill", sw.millis(), n);
+
+    int capacity = map.getCapacity();
+    int grown = powerOfTwo ? 2 * capacity : 1.5 * capacity;
+    double ms = 0;
+    for (int r = 0; r < rounds; r++)
+    {
+        ms += map.timeRehash(grown);
+        ms += map.timeRehash(capacity);
+    }
+    benchRow(name + ": rehash", ms / (2 * rounds), n); // ns/op: per entry moved
+}
+
+void rehashBench(int n = 1000000)
+{
+    mt19937 gen(n);
+    vector<int> ints(n);
+    vector<string> strings(n);
+    for (int i = 0; i < n; i++)
+    {
+        ints[i] = i;
+        strings[i] = "param_" + to_string(i) + "_weight";
+    }
+    shuffle(ints.begin(), ints.end(), gen);
+    shuffle(strings.begin(), strings.end(), gen);
+
+    cout << "-- n = " << n << ", int keys" << endl;
+    rehashBenchCase<int>("modulo capacity", ints, &xMap<int, int>::intKeyHash, false);
+    rehashBenchCase<int>("power-of-two, cached hash", ints, &xMap<int, int>::intKeyHash, true);
+    cout << "-- n = " << n << ", string keys" << endl;
+    rehashBenchCase<string>("modulo capacity", strings, &xMap<string, int>::stringKeyHash, false);
+    rehashBenchCase<string>("power-of-two, cached hash", strings, &xMap<string, int>::stringKeyHash, true);
+}
+
+#endif /* REHASHBENCH_H */
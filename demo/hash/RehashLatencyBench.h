@@ -0,0 +1,76 @@
+/*
+ * File:   RehashLatencyBench.h
+ *
+ * Benchmarks: latency of every xMap::put while the map grows to n keys,
+ *  with the whole-table rehash (default) and with setIncrementalRehash(step)
+ */
+
+#ifndef REHASHLATENCYBENCH_H
+#define REHASHLATENCYBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "hash/xMap.h"
+#include "hash/HashFunctions.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+/*
+ * latencyHistogram: counts per power-of-two latency bin, then the percentiles
+ */
+void latencyHistogram(vector<double> &nanos)
+{
+    long long bins[40] = {0};
+    for (double ns : nanos)
+    {
+        int bin = 0;
+        while (bin < 39 && ns >= (double)(2LL << bin))
+            bin++;
+        bins[bin]++;
+    }
+    for (int bin = 0; bin < 40; bin++)
+        if (bins[bin] > 0)
+            cout << "    < " << setw(12) << right << (2LL << bin) << " ns"
+                 << setw(12) << right << bins[bin] << endl;
+
+    sort(nanos.begin(), nanos.end());
+    double percents[] = {50, 99, 99.9, 99.99, 100};
+    string names[] = {"p50", "p99", "p99.9", "p99.99", "max"};
+    for (int i = 0; i < 5; i++)
+        cout << "    " << setw(9) << left << names[i]
+             << setw(12) << right << fixed << setprecision(0)
+             << nanos[(size_t)(percents[i] / 100 * (nanos.size() - 1))] << " ns" << endl;
+}
+
+/*
+ * rehashLatencyCase: put keys 0 .. n-1 and time each call;
+ *  with moduloIntHash the keys never collide (n < capacity), so the slow puts
+ *  are the ones that rehash
+ */
+void rehashLatencyCase(string name, int n, int step)
+{
+    xMap<int, int> map(&moduloIntHash);
+    map.setIncrementalRehash(step);
+    vector<double> nanos(n);
+
+    Stopwatch total;
+    for (int key = 0; key < n; key++)
+    {
+        Stopwatch sw;
+        map.put(key, key);
+        nanos[key] = sw.nanos();
+    }
+    cout << "-- " << name << ": " << fixed << setprecision(2) << total.millis() << " ms" << endl;
+    latencyHistogram(nanos);
+}
+
+void rehashLatencyBench(int n = 1000000)
+{
+    rehashLatencyCase("whole-table rehash", n, 0);
+    rehashLatencyCase("incremental rehash, 4 buckets/op", n, 4);
+}
+
+#endif /* REHASHLATENCYBENCH_H */
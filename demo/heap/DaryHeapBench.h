@@ -0,0 +1,70 @@
+/*
+ * File:   DaryHeapBench.h
+ *
+ * Benchmarks: push then pop n random ints, n = 10^4 .. 10^7,
+ *  Heap<int> (binary, comparator through a function pointer) against
+ *  DaryHeap<int, Arity> for Arity = 2, 4, 8 (functor comparator)
+ */
+
+#ifndef DARYHEAPBENCH_H
+#define DARYHEAPBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "heap/Heap.h"
+#include "heap/DaryHeap.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+int daryBenchComparator(int& lhs, int& rhs){
+    if(lhs < rhs) return -1;
+    else if(lhs > rhs) return +1;
+    else return 0;
+}
+
+/*
+ * daryHeapCase: "rounds" times: push all keys into an empty heap, then pop them all
+ */
+template<class H>
+void daryHeapCase(string name, vector<int>& keys, int rounds){
+    int n = keys.size();
+    long long sum = 0;
+    double pushMillis = 0, popMillis = 0;
+    for(int round=0; round < rounds; round++){
+        H heap;
+        Stopwatch sw;
+        for(int idx=0; idx < n; idx++) heap.push(keys[idx]);
+        pushMillis += sw.millis();
+        sw.reset();
+        for(int idx=0; idx < n; idx++) sum += heap.pop();
+        popMillis += sw.millis();
+    }
+    benchKeep(sum);
+    benchRow(name + ": push", pushMillis, (long long)n*rounds);
+    benchRow(name + ": pop", popMillis, (long long)n*rounds);
+}
+
+/* Heap<int> with its comparator through the function pointer */
+class BinaryPointerHeap: public Heap<int>{
+public:
+    BinaryPointerHeap(): Heap<int>(&daryBenchComparator){}
+};
+
+void daryHeapBench(int maxN = 10000000){
+    mt19937 gen(2024);
+    for(int n = 10000; n <= maxN; n *= 10){
+        vector<int> keys(n);
+        for(int idx=0; idx < n; idx++) keys[idx] = gen();
+        int rounds = max(1, 10000000/n/10); //about 10^6 .. 10^7 operations per case
+        cout << "-- n = " << n << ", " << rounds << " round(s)" << endl;
+        daryHeapCase<BinaryPointerHeap>("Heap<int>", keys, rounds);
+        daryHeapCase<DaryHeap<int, 2> >("DaryHeap<int, 2>", keys, rounds);
+        daryHeapCase<DaryHeap<int, 4> >("DaryHeap<int, 4>", keys, rounds);
+        daryHeapCase<DaryHeap<int, 8> >("DaryHeap<int, 8>", keys, rounds);
+    }
+}
+
+#endif /* DARYHEAPBENCH_H */
@@ -155,8 +155,8 @@ void anotherHeap(){
 void simpleMinHeap(){
     int array[] = {50, 20, 15, 10, 8, 6, 7, 23}; 
               //    0   1   2   3  4  5  6   7
-    //min heap: [6, 10, 7, 23, 15, 20, 8, 50]
-    //[6,10,7,23,15,20,8,50]
+    //min heap: [6, 8, 7, 10, 20, 15, 50, 23]
+    //(pushed one by one: [6,10,7,23,15,20,8,50])
 
     cout << "Input array: ";
     for(int idx =0; idx < 8; idx++) cout << array[idx]  << "  ";
@@ -174,7 +174,7 @@ void simpleMinHeap(){
 
 void heapDemo1(){
     int array[] = {50, 20, 15, 10, 8, 6, 7, 23}; 
-    //min heap: [6, 10, 7, 23, 15, 20, 8, 50]
+    //min heap: [6, 8, 7, 10, 20, 15, 50, 23]
     //max heap: [50, 23, 15, 20, 8, 6, 7, 10]
     Heap<int> minHeap1;
     cout << "Min Heap: ";
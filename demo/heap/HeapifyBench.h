@@ -0,0 +1,75 @@
+/*
+ * File:   HeapifyBench.h
+ *
+ * Benchmarks: building a heap from n random ints, then popping the k smallest
+ *  (as when seeding a k-way merge or a top-k selection from a large array)
+ *  + n push: n reheapUp, O(n log n)
+ *  + heapify / pushAll: one allocation and Floyd's bottom-up build, O(n)
+ *  + Heap(array, n): the same, in the caller's array (no copy)
+ */
+
+#ifndef HEAPIFYBENCH_H
+#define HEAPIFYBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include "heap/Heap.h"
+#include "heap/DaryHeap.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+template<class H>
+void heapifyPopK(H& heap, int k, long long& sum){
+    for(int idx=0; idx < k && !heap.empty(); idx++) sum += heap.pop();
+}
+
+void heapifyBench(int maxN = 10000000, int k = 100){
+    mt19937 gen(7);
+    for(int n = 100000; n <= maxN; n *= 10){
+        vector<int> keys(n);
+        for(int idx=0; idx < n; idx++) keys[idx] = gen();
+        long long sum = 0;
+        cout << "-- n = " << n << ", then pop " << k << endl;
+        {
+            Stopwatch sw;
+            Heap<int> heap;
+            for(int idx=0; idx < n; idx++) heap.push(keys[idx]);
+            heapifyPopK(heap, k, sum);
+            benchRow("Heap<int>: n push", sw.millis(), n);
+        }
+        {
+            Stopwatch sw;
+            Heap<int> heap;
+            heap.heapify(keys.data(), n);
+            heapifyPopK(heap, k, sum);
+            benchRow("Heap<int>: heapify (copy)", sw.millis(), n);
+        }
+        {
+            vector<int> array = keys; //not timed: the caller's array
+            Stopwatch sw;
+            Heap<int> heap(array.data(), n);
+            heapifyPopK(heap, k, sum);
+            benchRow("Heap<int>: Heap(array, n), in place", sw.millis(), n);
+        }
+        {
+            Stopwatch sw;
+            DaryHeap<int, 4> heap;
+            for(int idx=0; idx < n; idx++) heap.push(keys[idx]);
+            heapifyPopK(heap, k, sum);
+            benchRow("DaryHeap<int, 4>: n push", sw.millis(), n);
+        }
+        {
+            Stopwatch sw;
+            DaryHeap<int, 4> heap;
+            heap.pushAll(keys.begin(), keys.end());
+            heapifyPopK(heap, k, sum);
+            benchRow("DaryHeap<int, 4>: pushAll", sw.millis(), n);
+        }
+        benchKeep(sum);
+    }
+}
+
+#endif /* HEAPIFYBENCH_H */
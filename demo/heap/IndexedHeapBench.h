@@ -0,0 +1,118 @@
+/*
+ * File:   IndexedHeapBench.h
+ *
+ * Benchmarks: a priority queue of (vertex, distance) items, as in Dijkstra
+ *  + Heap<T>: remove(item) finds the item by a scan; a decrease-key is remove + push
+ *  + IndexedHeap<T>: erase(handle), remove(item) through the itemId hook, decreaseKey
+ */
+
+#ifndef INDEXEDHEAPBENCH_H
+#define INDEXEDHEAPBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "heap/Heap.h"
+#include "heap/IndexedHeap.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+struct BenchVertex{
+    int vertex;
+    int dist;
+    bool operator==(const BenchVertex& rhs) const{
+        return vertex == rhs.vertex;
+    }
+    bool operator<(const BenchVertex& rhs) const{
+        return dist < rhs.dist;
+    }
+    bool operator>(const BenchVertex& rhs) const{
+        return dist > rhs.dist;
+    }
+};
+ostream& operator<<(ostream& os, const BenchVertex& item){
+    return os << item.vertex << ":" << item.dist;
+}
+int benchVertexComparator(BenchVertex& lhs, BenchVertex& rhs){
+    if(lhs.dist < rhs.dist) return -1;
+    else if(lhs.dist > rhs.dist) return +1;
+    else return 0;
+}
+int benchVertexId(BenchVertex& item){
+    return item.vertex;
+}
+
+/*
+ * indexedHeapCase: a heap of n vertices, then nops removes and nops decrease-keys
+ *  of random vertices
+ */
+void indexedHeapCase(int n, int nops){
+    mt19937 gen(n);
+    vector<BenchVertex> items(n);
+    for(int v=0; v < n; v++) items[v] = BenchVertex{v, (int)(gen() % (10*n))};
+    vector<int> victims(n);
+    for(int v=0; v < n; v++) victims[v] = v;
+    shuffle(victims.begin(), victims.end(), gen);
+    long long sum = 0;
+
+    cout << "-- n = " << n << ", " << nops << " removes, " << nops << " decrease-keys" << endl;
+    {
+        Heap<BenchVertex> heap(&benchVertexComparator);
+        Stopwatch sw;
+        for(int v=0; v < n; v++) heap.push(items[v]);
+        benchRow("Heap: push", sw.millis(), n);
+        sw.reset();
+        for(int idx=0; idx < nops; idx++) heap.remove(items[victims[idx]]);
+        benchRow("Heap: remove(item), scan", sw.millis(), nops);
+        sw.reset();
+        for(int idx=nops; idx < 2*nops; idx++){
+            BenchVertex item = items[victims[idx]];
+            heap.remove(item);
+            item.dist /= 2;
+            heap.push(item);
+        }
+        benchRow("Heap: remove + push", sw.millis(), nops);
+        sum += heap.peek().dist;
+    }
+    {
+        IndexedHeap<BenchVertex> heap(&benchVertexComparator);
+        vector<int> handles(n);
+        Stopwatch sw;
+        for(int v=0; v < n; v++) handles[v] = heap.insert(items[v]);
+        benchRow("IndexedHeap: insert", sw.millis(), n);
+        sw.reset();
+        for(int idx=0; idx < nops; idx++) sum += heap.erase(handles[victims[idx]]).dist;
+        benchRow("IndexedHeap: erase(handle)", sw.millis(), nops);
+        sw.reset();
+        for(int idx=nops; idx < 2*nops; idx++){
+            int handle = handles[victims[idx]];
+            BenchVertex item = heap.get(handle);
+            item.dist /= 2;
+            heap.decreaseKey(handle, item);
+        }
+        benchRow("IndexedHeap: decreaseKey(handle)", sw.millis(), nops);
+        sum += heap.peek().dist;
+    }
+    {
+        IndexedHeap<BenchVertex> heap(&benchVertexComparator, &benchVertexId);
+        Stopwatch sw;
+        for(int v=0; v < n; v++) heap.push(items[v]);
+        benchRow("IndexedHeap+itemId: push", sw.millis(), n);
+        sw.reset();
+        for(int idx=0; idx < nops; idx++) heap.remove(items[victims[idx]]);
+        benchRow("IndexedHeap+itemId: remove(item)", sw.millis(), nops);
+        sum += heap.peek().dist;
+    }
+    benchKeep(sum);
+}
+
+void indexedHeapBench(){
+    indexedHeapCase(10000, 1000);
+    indexedHeapCase(100000, 10000);
+    indexedHeapCase(1000000, 1000);
+}
+
+#endif /* INDEXEDHEAPBENCH_H */
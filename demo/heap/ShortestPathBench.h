@@ -0,0 +1,297 @@
+/*
+ * File:   ShortestPathBench.h
+ *
+ * Benchmarks: single-source shortest paths (Dijkstra) on generated graphs, the same
+ *  run with each heap as the priority queue
+ *  + lazy Dijkstra (push a new (distance, vertex) item, skip the stale ones at pop):
+ *      Heap, DaryHeap<4>, PairingHeap, RadixHeap (keys: the float distances)
+ *  + Dijkstra with decrease-key: IndexedHeap (the vertex is the handle), PairingHeap
+ *  Graphs: random digraphs (out-degree 8) and 2D grids, integer weights 1..1000
+ *  stored as the float weight of the edges (the distances are exact: every heap
+ *  must give the same ones). The search runs over a compact adjacency array
+ *  (SPGraph); spGraphFromModel builds one from a DGraphModel with forEachEdge.
+ */
+
+#ifndef SHORTESTPATHBENCH_H
+#define SHORTESTPATHBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include "graph/DGraphModel.h"
+#include "heap/Heap.h"
+#include "heap/DaryHeap.h"
+#include "heap/IndexedHeap.h"
+#include "heap/PairingHeap.h"
+#include "heap/RadixHeap.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+/*
+ * SPGraph: vertices 0..nvertices-1; the edges out of v are
+ *  target[offset[v]..offset[v+1]), weight[...]
+ */
+struct SPGraph{
+    int nvertices;
+    vector<int> offset;
+    vector<int> target;
+    vector<float> weight;
+};
+
+struct VertexDist{
+    float dist;
+    int vertex;
+    bool operator==(const VertexDist& rhs) const{
+        return vertex == rhs.vertex;
+    }
+    bool operator<(const VertexDist& rhs) const{
+        return dist < rhs.dist;
+    }
+    bool operator>(const VertexDist& rhs) const{
+        return dist > rhs.dist;
+    }
+    float key() const{ //for FloatRadixKey
+        return dist;
+    }
+};
+ostream& operator<<(ostream& os, const VertexDist& item){
+    return os << item.vertex << ":" << item.dist;
+}
+int vertexDistComparator(VertexDist& lhs, VertexDist& rhs){
+    if(lhs.dist < rhs.dist) return -1;
+    else if(lhs.dist > rhs.dist) return +1;
+    else return 0;
+}
+int vertexDistId(VertexDist& item){
+    return item.vertex;
+}
+bool spVertexEQ(int& lhs, int& rhs){
+    return lhs == rhs;
+}
+string spVertex2str(int& vertex){
+    return to_string(vertex);
+}
+
+/*
+ * spGraphFromEdges: the adjacency array of edges over vertices 0..nvertices-1
+ *  (a counting sort by the source vertex)
+ */
+SPGraph spGraphFromEdges(int nvertices, vector<Edge<int> >& edges){
+    SPGraph graph;
+    graph.nvertices = nvertices;
+    graph.offset.assign(nvertices + 1, 0);
+    graph.target.resize(edges.size());
+    graph.weight.resize(edges.size());
+    for(Edge<int>& edge: edges) graph.offset[edge.from + 1] += 1;
+    for(int v=0; v < nvertices; v++) graph.offset[v + 1] += graph.offset[v];
+
+    vector<int> next(graph.offset.begin(), graph.offset.end() - 1);
+    for(Edge<int>& edge: edges){
+        int idx = next[edge.from]++;
+        graph.target[idx] = edge.to;
+        graph.weight[idx] = edge.weight;
+    }
+    return graph;
+}
+
+/*
+ * spGraphFromModel: the same from a graph model whose vertices are 0..size()-1
+ */
+SPGraph spGraphFromModel(DGraphModel<int>& model){
+    vector<Edge<int> > edges;
+    model.forEachEdge([&](int from, int to, float weight){
+        edges.push_back(Edge<int>(from, to, weight));
+    });
+    return spGraphFromEdges(model.size(), edges);
+}
+
+vector<Edge<int> > spRandomEdges(int nvertices, int degree, mt19937& gen){
+    vector<Edge<int> > edges;
+    edges.reserve((size_t)nvertices*degree);
+    for(int v=0; v < nvertices; v++)
+        for(int idx=0; idx < degree; idx++)
+            edges.push_back(Edge<int>(v, gen() % nvertices, 1 + gen() % 1000));
+    return edges;
+}
+
+vector<Edge<int> > spGridEdges(int side, mt19937& gen){
+    vector<Edge<int> > edges;
+    edges.reserve((size_t)side*side*4);
+    for(int row=0; row < side; row++){
+        for(int col=0; col < side; col++){
+            int v = row*side + col;
+            if(col + 1 < side){
+                edges.push_back(Edge<int>(v, v + 1, 1 + gen() % 1000));
+                edges.push_back(Edge<int>(v + 1, v, 1 + gen() % 1000));
+            }
+            if(row + 1 < side){
+                edges.push_back(Edge<int>(v, v + side, 1 + gen() % 1000));
+                edges.push_back(Edge<int>(v + side, v, 1 + gen() % 1000));
+            }
+        }
+    }
+    return edges;
+}
+
+/*
+ * lazyDijkstra: queue is any IHeap<VertexDist> with the smallest distance on top;
+ *  return the number of pushes
+ */
+template<class H>
+long long lazyDijkstra(SPGraph& graph, int source, H& queue, vector<float>& dist){
+    dist.assign(graph.nvertices, numeric_limits<float>::infinity());
+    dist[source] = 0;
+    queue.push(VertexDist{0, source});
+    long long npush = 1;
+    while(!queue.empty()){
+        VertexDist top = queue.pop();
+        if(top.dist > dist[top.vertex]) continue; //stale
+        for(int idx=graph.offset[top.vertex]; idx < graph.offset[top.vertex + 1]; idx++){
+            int to = graph.target[idx];
+            float next = top.dist + graph.weight[idx];
+            if(next < dist[to]){
+                dist[to] = next;
+                queue.push(VertexDist{next, to});
+                npush += 1;
+            }
+        }
+    }
+    return npush;
+}
+
+/*
+ * indexedDijkstra: one item per vertex, decreaseKey through the itemId hook
+ */
+long long indexedDijkstra(SPGraph& graph, int source, vector<float>& dist){
+    IndexedHeap<VertexDist> queue(&vertexDistComparator, &vertexDistId);
+    dist.assign(graph.nvertices, numeric_limits<float>::infinity());
+    dist[source] = 0;
+    queue.push(VertexDist{0, source});
+    long long nops = 1;
+    while(!queue.empty()){
+        VertexDist top = queue.pop();
+        for(int idx=graph.offset[top.vertex]; idx < graph.offset[top.vertex + 1]; idx++){
+            int to = graph.target[idx];
+            float next = top.dist + graph.weight[idx];
+            if(next < dist[to]){
+                if(queue.containsHandle(to)) queue.decreaseKey(to, VertexDist{next, to});
+                else queue.push(VertexDist{next, to});
+                dist[to] = next;
+                nops += 1;
+            }
+        }
+    }
+    return nops;
+}
+
+/*
+ * pairingDijkstra: one node per vertex, decreaseKey through the handles
+ */
+long long pairingDijkstra(SPGraph& graph, int source, vector<float>& dist){
+    typedef PairingHeap<VertexDist>::Node Node;
+    PairingHeap<VertexDist> queue;
+    vector<Node*> handle(graph.nvertices, 0); //0: not in the queue
+    dist.assign(graph.nvertices, numeric_limits<float>::infinity());
+    dist[source] = 0;
+    handle[source] = queue.insert(VertexDist{0, source});
+    long long nops = 1;
+    while(!queue.empty()){
+        VertexDist top = queue.pop();
+        handle[top.vertex] = 0;
+        for(int idx=graph.offset[top.vertex]; idx < graph.offset[top.vertex + 1]; idx++){
+            int to = graph.target[idx];
+            float next = top.dist + graph.weight[idx];
+            if(next < dist[to]){
+                if(handle[to] != 0) queue.decreaseKey(handle[to], VertexDist{next, to});
+                else handle[to] = queue.insert(VertexDist{next, to});
+                dist[to] = next;
+                nops += 1;
+            }
+        }
+    }
+    return nops;
+}
+
+/*
+ * shortestPathCase: every variant from the same source; the distances must match
+ *  those of the first one
+ */
+void shortestPathCase(string name, SPGraph& graph, int source=0){
+    cout << "-- " << name << ": V = " << graph.nvertices
+         << ", E = " << graph.target.size() << endl;
+    vector<float> expected, dist;
+    long long nops;
+    bool same = true;
+    {
+        Heap<VertexDist> queue(&vertexDistComparator);
+        Stopwatch sw;
+        nops = lazyDijkstra(graph, source, queue, expected);
+        benchRow("Heap (lazy)", sw.millis(), nops);
+    }
+    {
+        DaryHeap<VertexDist, 4> queue;
+        Stopwatch sw;
+        nops = lazyDijkstra(graph, source, queue, dist);
+        benchRow("DaryHeap<4> (lazy)", sw.millis(), nops);
+        same = same && dist == expected;
+    }
+    {
+        PairingHeap<VertexDist> queue;
+        Stopwatch sw;
+        nops = lazyDijkstra(graph, source, queue, dist);
+        benchRow("PairingHeap (lazy)", sw.millis(), nops);
+        same = same && dist == expected;
+    }
+    {
+        RadixHeap<VertexDist, FloatRadixKey<VertexDist> > queue;
+        Stopwatch sw;
+        nops = lazyDijkstra(graph, source, queue, dist);
+        benchRow("RadixHeap (lazy)", sw.millis(), nops);
+        same = same && dist == expected;
+    }
+    {
+        Stopwatch sw;
+        nops = indexedDijkstra(graph, source, dist);
+        benchRow("IndexedHeap (decreaseKey)", sw.millis(), nops);
+        same = same && dist == expected;
+    }
+    {
+        Stopwatch sw;
+        nops = pairingDijkstra(graph, source, dist);
+        benchRow("PairingHeap (decreaseKey)", sw.millis(), nops);
+        same = same && dist == expected;
+    }
+    if(!same) cout << "!! the distances differ between the heaps" << endl;
+}
+
+void shortestPathBench(int maxN = 1000000){
+    mt19937 gen(25);
+    {
+        //a small graph through the graph model: forEachEdge => SPGraph
+        int n = 2000;
+        vector<int> vertices(n);
+        for(int v=0; v < n; v++) vertices[v] = v;
+        vector<Edge<int> > edges = spRandomEdges(n, 8, gen);
+        DGraphModel<int>* model = DGraphModel<int>::create(
+                vertices.data(), n, edges.data(), (int)edges.size(), &spVertexEQ, &spVertex2str);
+        SPGraph graph = spGraphFromModel(*model);
+        shortestPathCase("DGraphModel, random", graph);
+        model->clear();
+        delete model;
+    }
+    for(int n = 10000; n <= maxN; n *= 10){
+        vector<Edge<int> > edges = spRandomEdges(n, 8, gen);
+        SPGraph graph = spGraphFromEdges(n, edges);
+        shortestPathCase("random", graph);
+    }
+    for(int side = 100; side*side <= maxN; side *= 10){
+        vector<Edge<int> > edges = spGridEdges(side, gen);
+        SPGraph graph = spGraphFromEdges(side*side, edges);
+        shortestPathCase("grid " + to_string(side) + "x" + to_string(side), graph);
+    }
+}
+
+#endif /* SHORTESTPATHBENCH_H */
@@ -0,0 +1,75 @@
+/*
+ * File:   TopKBench.h
+ *
+ * Benchmarks: the k largest of n random doubles
+ *  + Heap<double>: push everything (a max-heap), pop k
+ *  + DaryHeap<double, 4>: pushAll (bottom-up), pop k
+ *  + TopK<double>: one pass, keeps k items
+ *  + topK(): TopK per thread, then merged
+ */
+
+#ifndef TOPKBENCH_H
+#define TOPKBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include <thread>
+#include <functional>
+#include "heap/Heap.h"
+#include "heap/DaryHeap.h"
+#include "heap/TopK.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+int topKBenchMaxComparator(double& lhs, double& rhs){
+    if(lhs > rhs) return -1;
+    else if(lhs < rhs) return +1;
+    else return 0;
+}
+
+void topKBench(int n = 10000000){
+    mt19937_64 gen(11);
+    uniform_real_distribution<double> uniform(0, 1);
+    vector<double> scores(n);
+    for(int idx=0; idx < n; idx++) scores[idx] = uniform(gen);
+    int nthreads = max(4u, thread::hardware_concurrency());
+
+    for(int k: {10, 100, 1000}){
+        double sum = 0;
+        cout << "-- n = " << n << ", k = " << k << endl;
+        {
+            Stopwatch sw;
+            Heap<double> heap(&topKBenchMaxComparator);
+            for(int idx=0; idx < n; idx++) heap.push(scores[idx]);
+            for(int idx=0; idx < k; idx++) sum += heap.pop();
+            benchRow("Heap: push all, pop k", sw.millis(), n);
+        }
+        {
+            Stopwatch sw;
+            DaryHeap<double, 4, greater<double> > heap;
+            heap.pushAll(scores.begin(), scores.end());
+            for(int idx=0; idx < k; idx++) sum += heap.pop();
+            benchRow("DaryHeap: pushAll, pop k", sw.millis(), n);
+        }
+        {
+            Stopwatch sw;
+            TopK<double> best(k);
+            best.offerAll(scores.begin(), scores.end());
+            vector<double> top = best.sorted();
+            sum += top[0];
+            benchRow("TopK: 1 thread", sw.millis(), n);
+        }
+        {
+            Stopwatch sw;
+            vector<double> top = topK(scores.begin(), scores.end(), k, nthreads);
+            sum += top[0];
+            benchRow("topK: " + to_string(nthreads) + " threads", sw.millis(), n);
+        }
+        benchKeep(sum);
+    }
+}
+
+#endif /* TOPKBENCH_H */
@@ -0,0 +1,96 @@
+/*
+ * File:   DLinkedListBench.h
+ *
+ * Benchmarks for DLinkedList<T>
+ */
+
+#ifndef DLINKEDLISTBENCH_H
+#define DLINKEDLISTBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include "list/DLinkedList.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+/*
+ * dlistPoolBench: add/remove throughput with new/delete vs. DLinkedList<T>::NodePool
+ *  + fill/clear: n x add, then clear (bulk release)
+ *  + churn: queue-like add at the rear, removeAt(0) at the front
+ */
+template<class T>
+void dlistPoolBenchCase(string tname, int n, int rounds){
+    cout << "-- DLinkedList<" << tname << ">: n = " << n << ", rounds = " << rounds << endl;
+    for(int usePool = 0; usePool < 2; usePool++){
+        typename DLinkedList<T>::NodePool pool(256);
+        DLinkedList<T> list(0, 0, usePool ? &pool : 0);
+        string mode = usePool ? "pool" : "new/delete";
+
+        Stopwatch sw;
+        for(int r=0; r < rounds; r++){
+            for(int i=0; i < n; i++) list.add(T());
+            list.clear();
+        }
+        benchRow("fill/clear (" + mode + ")", sw.millis(), (long long)n*rounds);
+
+        for(int i=0; i < 64; i++) list.add(T());
+        sw.reset();
+        for(int r=0; r < rounds; r++){
+            for(int i=0; i < n; i++){
+                list.add(T());
+                benchKeep(list.removeAt(0));
+            }
+        }
+        benchRow("add/removeAt(0) (" + mode + ")", sw.millis(), (long long)n*rounds);
+        list.clear();
+    }
+}
+
+void dlistPoolBench(){
+    dlistPoolBenchCase<int>("int", 100000, 20);
+    dlistPoolBenchCase<string>("string", 100000, 10);
+}
+
+/*
+ * dlistGetBench: indexed access get(i)
+ *  + sequential/reverse loops are served from the cursor in O(1) per call
+ *  + random access walks from the closest of head, tail and cursor
+ *  + "walk from head" reproduces a get(i) that always starts at head
+ */
+void dlistGetBench(){
+    int sizes[] = {1000, 10000, 50000};
+    for(int n: sizes){
+        cout << "-- DLinkedList<int>::get: n = " << n << endl;
+        DLinkedList<int> list;
+        for(int i=0; i < n; i++) list.add(i);
+
+        long long sum = 0;
+        Stopwatch sw;
+        for(int i=0; i < n; i++) sum += list.get(i);
+        benchRow("sequential get(i)", sw.millis(), n);
+
+        sw.reset();
+        for(int i=n-1; i >= 0; i--) sum += list.get(i);
+        benchRow("reverse get(i)", sw.millis(), n);
+
+        mt19937 gen(n);
+        uniform_int_distribution<int> dist(0, n - 1);
+        int nrandom = 2000;
+        sw.reset();
+        for(int i=0; i < nrandom; i++) sum += list.get(dist(gen));
+        benchRow("random get(i)", sw.millis(), nrandom);
+
+        sw.reset();
+        for(int i=0; i < nrandom; i++){
+            int index = dist(gen);
+            DLinkedList<int>::Iterator it = list.begin();
+            for(int k=0; k < index; k++) it++;
+            sum += *it;
+        }
+        benchRow("random, walk from head", sw.millis(), nrandom);
+        benchKeep(sum);
+    }
+}
+
+#endif /* DLINKEDLISTBENCH_H */
@@ -0,0 +1,64 @@
+/*
+ * File:   UnrolledLinkedListBench.h
+ *
+ * Benchmarks: UnrolledLinkedList<T> against DLinkedList<T>
+ */
+
+#ifndef UNROLLEDLINKEDLISTBENCH_H
+#define UNROLLEDLINKEDLISTBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include "list/DLinkedList.h"
+#include "list/UnrolledLinkedList.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+/*
+ * ulistBenchCase: on a list of n items (filled in shuffled insertion order, so
+ *      DLinkedList nodes are scattered in memory as in long-lived adjacency lists)
+ *  + traversal: sum of all items with Iterator
+ *  + indexOf: lookup of nlookups random items
+ *  + removeItem: removal of nlookups random items
+ */
+template<class L>
+void ulistBenchCase(string name, int n, int nlookups){
+    L list;
+    mt19937 gen(n);
+    for(int i=0; i < n; i++){
+        int index = list.size() == 0 ? 0 : gen() % (list.size() + 1);
+        list.add(index, i);
+    }
+
+    long long sum = 0;
+    int rounds = 20;
+    Stopwatch sw;
+    for(int r=0; r < rounds; r++){
+        for(typename L::Iterator it = list.begin(); it != list.end(); it++) sum += *it;
+    }
+    benchRow(name + ": traversal", sw.millis(), (long long)n*rounds);
+
+    uniform_int_distribution<int> dist(0, n - 1);
+    sw.reset();
+    for(int i=0; i < nlookups; i++) sum += list.indexOf(dist(gen));
+    benchRow(name + ": indexOf", sw.millis(), nlookups);
+
+    sw.reset();
+    for(int i=0; i < nlookups; i++) sum += list.removeItem(dist(gen));
+    benchRow(name + ": removeItem", sw.millis(), nlookups);
+    benchKeep(sum);
+}
+
+void ulistBench(){
+    int sizes[] = {1000, 10000, 100000};
+    for(int n: sizes){
+        cout << "-- n = " << n << endl;
+        int nlookups = n < 10000 ? 1000 : 200;
+        ulistBenchCase<DLinkedList<int>>("DLinkedList", n, nlookups);
+        ulistBenchCase<UnrolledLinkedList<int>>("UnrolledLinkedList<16>", n, nlookups);
+        ulistBenchCase<UnrolledLinkedList<int, 64>>("UnrolledLinkedList<64>", n, nlookups);
+    }
+}
+
+#endif /* UNROLLEDLINKEDLISTBENCH_H */
@@ -0,0 +1,55 @@
+/*
+ * File:   DeckBench.h
+ *
+ * Benchmarks: list-backed Queue<T>/Stack<T> against ArrayQueue<T>/ArrayStack<T>
+ *  (build without DSA_ARRAY_DECK, otherwise Queue/Stack already are the array versions)
+ */
+
+#ifndef DECKBENCH_H
+#define DECKBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include "stacknqueue/Queue.h"
+#include "stacknqueue/Stack.h"
+#include "stacknqueue/ArrayQueue.h"
+#include "stacknqueue/ArrayStack.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+/*
+ * deckBenchCase: "rounds" cycles of n pushes followed by n pops
+ *  + fill/drain: the deck grows to n items, then is emptied
+ *  + steady: the deck stays small, each push is followed by a pop (as in a BFS frontier)
+ */
+template<class D>
+void deckBenchCase(string name, int n, int rounds){
+    D deck;
+    long long sum = 0;
+    Stopwatch sw;
+    for(int r=0; r < rounds; r++){
+        for(int i=0; i < n; i++) deck.push(i);
+        while(!deck.empty()) sum += deck.pop();
+    }
+    benchRow(name + ": fill/drain", sw.millis(), 2LL*n*rounds);
+
+    sw.reset();
+    for(int i=0; i < 8; i++) deck.push(i);
+    for(long long i=0; i < (long long)n*rounds; i++){
+        deck.push((int)i);
+        sum += deck.pop();
+    }
+    benchRow(name + ": steady", sw.millis(), 2LL*n*rounds);
+    benchKeep(sum);
+}
+
+void deckBench(){
+    int n = 1000000, rounds = 5;
+    cout << "-- n = " << n << ", rounds = " << rounds << endl;
+    deckBenchCase<Queue<int>>("Queue (DLinkedList)", n, rounds);
+    deckBenchCase<ArrayQueue<int>>("ArrayQueue", n, rounds);
+    deckBenchCase<Stack<int>>("Stack (DLinkedList)", n, rounds);
+    deckBenchCase<ArrayStack<int>>("ArrayStack", n, rounds);
+}
+
+#endif /* DECKBENCH_H */
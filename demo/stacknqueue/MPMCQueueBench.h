@@ -0,0 +1,104 @@
+/*
+ * File:   MPMCQueueBench.h
+ *
+ * Benchmarks: MPMCQueue<T> and SegmentedMPMCQueue<T> against a mutex-wrapped Queue<T>,
+ *  with 1..N producers and as many consumers
+ */
+
+#ifndef MPMCQUEUEBENCH_H
+#define MPMCQUEUEBENCH_H
+
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include "stacknqueue/Queue.h"
+#include "stacknqueue/MPMCQueue.h"
+#include "util/Stopwatch.h"
+using namespace std;
+
+/*
+ * LockedQueue<T>: Queue<T> behind one mutex, the baseline for the lock-free queues
+ */
+template<class T>
+class LockedQueue{
+private:
+    Queue<T> queue;
+    mutex lock;
+public:
+    bool try_push(T item){
+        lock_guard<mutex> guard(lock);
+        queue.push(std::move(item));
+        return true;
+    }
+    bool try_pop(T& item){
+        lock_guard<mutex> guard(lock);
+        if(queue.empty()) return false;
+        item = queue.pop();
+        return true;
+    }
+};
+
+/*
+ * mpmcBenchCase: nthreads producers push nitems items in total, nthreads consumers
+ *      pop until all of them are received; reports the time per item
+ */
+template<class Q>
+void mpmcBenchCase(string name, Q& queue, int nthreads, int nitems){
+    atomic<long long> received(0), sum(0);
+    int perProducer = nitems / nthreads;
+    long long total = (long long)perProducer * nthreads;
+    vector<thread> threads;
+
+    Stopwatch sw;
+    for(int p=0; p < nthreads; p++){
+        threads.emplace_back([&queue, perProducer](){
+            for(int i=0; i < perProducer; i++){
+                while(!queue.try_push(i)) this_thread::yield();
+            }
+        });
+    }
+    for(int c=0; c < nthreads; c++){
+        threads.emplace_back([&queue, &received, &sum, total](){
+            long long local = 0;
+            int item;
+            while(received.load(memory_order_relaxed) < total){
+                if(queue.try_pop(item)){
+                    local += item;
+                    received.fetch_add(1, memory_order_relaxed);
+                }
+                else this_thread::yield();
+            }
+            sum.fetch_add(local);
+        });
+    }
+    for(auto& t: threads) t.join();
+    benchRow(name, sw.millis(), total);
+    benchKeep(sum.load());
+}
+
+void mpmcBench(){
+    int nitems = 1000000;
+    int maxThreads = (int)thread::hardware_concurrency() / 2;
+    if(maxThreads < 1) maxThreads = 1;
+    if(maxThreads > 8) maxThreads = 8;
+    for(int n=1; n <= maxThreads; n *= 2){
+        cout << "-- producers = consumers = " << n << endl;
+        {
+            LockedQueue<int> queue;
+            mpmcBenchCase("mutex + Queue", queue, n, nitems);
+        }
+        {
+            MPMCQueue<int> queue(1024);
+            mpmcBenchCase("MPMCQueue(1024)", queue, n, nitems);
+        }
+        {
+            SegmentedMPMCQueue<int> queue;
+            mpmcBenchCase("SegmentedMPMCQueue<1024>", queue, n, nitems);
+        }
+    }
+}
+
+#endif /* MPMCQUEUEBENCH_H */
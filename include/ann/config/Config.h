@@ -27,7 +27,7 @@ public:
     Config(string cfg_filename="config.txt");
     Config(const Config& orig);
     virtual ~Config();
-    string get(string key, string def_value);
+    string get(string_view key, const string& def_value);
     string get_new_checkpoint(string model_name);
     
 protected:
@@ -13,6 +13,7 @@
 #ifndef FUNTIONS_H
 #define FUNTIONS_H
 #include <string>
+#include <string_view>
 #include <sstream>
 using namespace std;
 #include <memory>
@@ -48,6 +49,7 @@ double_tensor calc_classifcation_metrics(ulong_tensor y_true, ulong_tensor y_pre
 
 
 int stringHash(string& str, int size);
+int stringViewHash(string_view str, int size); // stringHash of a key view (xMap::setViewHash)
 
 /*
  * Thanks to:
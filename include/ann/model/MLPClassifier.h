@@ -33,6 +33,12 @@ public:
     double_tensor predict(
                 DataLoader<double, double>* pLoader,
                 bool make_decision=false);
+    /*
+     * predict_topk(X, k, pScores): for each sample of X, the k most probable
+     *  classes, the most probable first; shape (nsamples, k), k is capped by the
+     *  number of classes. If pScores is not 0, it receives their probabilities.
+     */
+    ulong_tensor predict_topk(double_tensor X, int k, double_tensor* pScores=0);
     double_tensor evaluate(DataLoader<double, double>* pLoader);
     
     //for the training mode:
@@ -14,6 +14,7 @@
 #ifndef ABSTRACTGRAPH_H
 #define ABSTRACTGRAPH_H
 #include "graph/IGraph.h"
+#include "list/IntrusiveList.h"
 #include <string>
 #include <sstream>
 #include <iomanip>
@@ -29,8 +30,9 @@ public:
 
 private:
 protected:
-    // Using the adjacent list technique, so need to store list of nodes (nodeList)
-    DLinkedList<VertexNode *> nodeList;
+    // Using the adjacent list technique, so need to store list of nodes (nodeList);
+    // the links live inside VertexNode, so a traversal touches only the nodes themselves
+    IntrusiveList<VertexNode> nodeList;
 
     // Function pointers:
     bool (*vertexEQ)(T &, T &); // to compare two vertices
@@ -38,7 +40,7 @@ protected:
 
     VertexNode *getVertexNode(T &vertex)
     {
-        typename DLinkedList<VertexNode *>::Iterator it = nodeList.begin();
+        typename IntrusiveList<VertexNode>::Iterator it = nodeList.begin();
         while (it != nodeList.end())
         {
             VertexNode *node = *it;
@@ -109,7 +111,7 @@ public:
     virtual bool contains(T vertex)
     {
         // TODO
-        typename DLinkedList<VertexNode *>::Iterator it = nodeList.begin();
+        typename IntrusiveList<VertexNode>::Iterator it = nodeList.begin();
         while (it != nodeList.end())
         {
             VertexNode *node = *it;
@@ -174,7 +176,7 @@ public:
         if (toN == NULL)
             throw VertexNotFoundException(vertex2str(to));
 
-        typename DLinkedList<VertexNode *>::Iterator it = nodeList.begin();
+        typename IntrusiveList<VertexNode>::Iterator it = nodeList.begin();
         while (it != nodeList.end())
         {
             VertexNode *node = *it;
@@ -211,14 +213,7 @@ public:
         //     this->remove(this->nodeList.get(0)->vertex);
         // }
 
-        typename DLinkedList<VertexNode *>::Iterator it = nodeList.begin();
-        while (it != nodeList.end())
-        {
-            VertexNode *node = *it;
-            delete node;
-            it++;
-        }
-        nodeList.clear();
+        IntrusiveList<VertexNode>::free(&nodeList);
 
     }
     virtual int inDegree(T vertex)
@@ -229,7 +224,7 @@ public:
         if (node == nullptr)
             throw VertexNotFoundException(vertex2str(vertex));
 
-        typename DLinkedList<VertexNode *>::Iterator it = this->nodeList.begin();
+        typename IntrusiveList<VertexNode>::Iterator it = this->nodeList.begin();
         while (it != nodeList.end())
         {
             VertexNode *node = *it;
@@ -260,7 +255,7 @@ public:
     {
         // TODO
         DLinkedList<T> list;
-        typename DLinkedList<VertexNode *>::Iterator it = nodeList.begin();
+        typename IntrusiveList<VertexNode>::Iterator it = nodeList.begin();
         while (it != nodeList.end())
         {
             VertexNode *node = *it;
@@ -269,6 +264,27 @@ public:
         }
         return list;
     }
+    /*
+     * forEachEdge(visit): visit(from, to, weight) for every edge, in one pass over
+     *  the adjacency lists, O(V + E) (no vertex lookups, unlike weight(from, to))
+     */
+    template <class Visit>
+    void forEachEdge(Visit visit)
+    {
+        typename IntrusiveList<VertexNode>::Iterator it = nodeList.begin();
+        while (it != nodeList.end())
+        {
+            VertexNode *node = *it;
+            typename DLinkedList<Edge *>::Iterator edgeIt = node->adList.begin();
+            while (edgeIt != node->adList.end())
+            {
+                Edge *edge = *edgeIt;
+                visit(node->vertex, edge->to->vertex, edge->weight);
+                edgeIt++;
+            }
+            it++;
+        }
+    }
     virtual bool connected(T from, T to)
     {
         // TODO
@@ -302,7 +318,7 @@ public:
         stringstream os;
         os << mark << endl;
         os << left << setw(12) << "Vertices:" << endl;
-        typename DLinkedList<VertexNode *>::Iterator nodeIt = nodeList.begin();
+        typename IntrusiveList<VertexNode>::Iterator nodeIt = nodeList.begin();
         while (nodeIt != nodeList.end())
         {
             VertexNode *node = *nodeIt;
@@ -358,7 +374,7 @@ public:
 
 public:
     // BEGIN of VertexNode
-    class VertexNode
+    class VertexNode : public IntrusiveListHook<>
     {
     private:
         template <class U>
@@ -445,7 +461,7 @@ public:
                 Edge *edge = *it;
                 if (vertexEQ(edge->to->vertex, to->vertex))
                 {
-                    adList.removeItem(edge);
+                    it.remove(); // unlink here, no second scan
                     this->outDegree_--;
                     to->inDegree_--;
                     delete edge;
@@ -545,7 +561,7 @@ public:
     class Iterator
     {
     private:
-        typename DLinkedList<VertexNode *>::Iterator nodeIt;
+        typename IntrusiveList<VertexNode>::Iterator nodeIt;
 
     public:
         Iterator(AbstractGraph<T> *pGraph = 0, bool begin = true)
@@ -125,6 +125,7 @@ protected:
     xMap<T, int> vertex2inDegree(int (*hash)(T &, int))
     {
         xMap<T, int> map(hash);
+        map.reserve(this->graph->size()); // one table, no rehash while filling
         typename DGraphModel<T>::Iterator vertexIt = this->graph->begin();
         while (vertexIt != this->graph->end())
         {
@@ -139,6 +140,7 @@ protected:
     xMap<T, int> vertex2outDegree(int (*hash)(T &, int))
     {
         xMap<T, int> map(hash);
+        map.reserve(this->graph->size()); // one table, no rehash while filling
         typename DGraphModel<T>::Iterator vertexIt = this->graph->begin();
         while (vertexIt != this->graph->end())
         {
@@ -94,7 +94,7 @@ public:
         if (node == nullptr)
             throw VertexNotFoundException(this->vertex2str(vertex));
 
-        typename DLinkedList<typename AbstractGraph<T>::VertexNode *>::Iterator it = this->nodeList.begin();
+        typename IntrusiveList<typename AbstractGraph<T>::VertexNode>::Iterator it = this->nodeList.begin();
         while (it != this->nodeList.end())
         {
             typename AbstractGraph<T>::VertexNode *otherNode = *it;
@@ -123,7 +123,7 @@ public:
             typename AbstractGraph<T>::VertexNode *fromNode = nullptr;
             typename AbstractGraph<T>::VertexNode *toNode = nullptr;
 
-            typename DLinkedList<typename AbstractGraph<T>::VertexNode *>::Iterator it = graph->nodeList.begin();
+            typename IntrusiveList<typename AbstractGraph<T>::VertexNode>::Iterator it = graph->nodeList.begin();
             while (it != graph->nodeList.end())
             {
                 typename AbstractGraph<T>::VertexNode *node = *it;
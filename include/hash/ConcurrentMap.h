@@ -0,0 +1,434 @@
+/*
+ * File:   ConcurrentMap.h
+ *
+ * Thread-safe hash map: the key space is split over N shards, each one an xMap<K, V>
+ *  guarded by its own reader/writer lock
+ */
+
+#ifndef CONCURRENTMAP_H
+#define CONCURRENTMAP_H
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <new>
+#include <sstream>
+#include "hash/IMap.h"
+#include "hash/xMap.h"
+#include "hash/HashFunctions.h"
+
+/*
+ * ConcurrentMap<K, V>:
+ *  + a key always goes to the same shard (top bits of its hash), so operations on keys
+ *      of different shards never wait for each other
+ *  + thread-safe:
+ *      >> put, remove, compute_if_absent: exclusive lock of one shard
+ *      >> get, tryGet, containsKey: shared lock of one shard (readers do not block readers)
+ *      >> size, empty: lock-free, sum of per-shard counters (a snapshot, may be stale)
+ *      >> keys, values, containsValue, snapshot, clashes, toString, clear:
+ *          one shard at a time; consistent per shard, not across shards
+ *  + get returns a reference to the value stored in the map: it stays valid until the
+ *      key is removed (entries never move), but reading it while another thread puts the
+ *      same key is a data race; prefer tryGet, which copies the value under the lock
+ *  + the shards use power-of-two indexing and whole-table rehash
+ *      (an incremental rehash would write to the shard inside get)
+ */
+template <class K, class V>
+class ConcurrentMap : public IMap<K, V>
+{
+public:
+    class Shard;    // forward declaration
+    class Snapshot; // forward declaration
+
+protected:
+    static const int HASH_RANGE = 0x7FFFFFFF;
+
+    Shard* shards;
+    int nshards;
+    int (*hashCode)(K&, int);
+
+public:
+    ConcurrentMap(
+        int (*hashCode)(K&, int), // require
+        float loadFactor = 0.75f,
+        bool (*valueEqual)(V&, V&) = 0,
+        void (*deleteValues)(xMap<K, V>*) = 0,
+        bool (*keyEqual)(K&, K&) = 0,
+        void (*deleteKeys)(xMap<K, V>*) = 0,
+        int nshards = 16);
+    ConcurrentMap(const ConcurrentMap<K, V>& map) = delete;
+    ConcurrentMap<K, V>& operator=(const ConcurrentMap<K, V>& map) = delete;
+    ~ConcurrentMap();
+
+    // Inherit from IMap:BEGIN
+    V put(const K& key, const V& value);
+    V& get(const K& key);
+    V remove(const K& key, void (*deleteKeyInMap)(K) = 0);
+    bool remove(const K& key, const V& value, void (*deleteKeyInMap)(K) = 0, void (*deleteValueInMap)(V) = 0);
+    bool containsKey(const K& key);
+    bool containsValue(const V& value);
+    bool empty();
+    int size();
+    void clear();
+    string toString(string (*key2str)(K&) = 0, string (*value2str)(V&) = 0);
+    DLinkedList<K> keys();
+    DLinkedList<V> values();
+    DLinkedList<int> clashes();
+    // Inherit from IMap:END
+
+    /*
+     * tryGet(key, value): copy the value of key into "value" and return true,
+     *  or return false if key is not in the map
+     */
+    bool tryGet(const K& key, V& value);
+    /*
+     * compute_if_absent(key, mapping): return the value of key; if key is absent,
+     *  store mapping(key) first. The check and the insert are one atomic step, so
+     *  mapping runs at most once per key; it runs under the shard lock and must
+     *  not use this map.
+     *  Example:
+     *      int id = map.compute_if_absent(name, [&](const string& key){ return nextId++; });
+     */
+    template <class Function>
+    V compute_if_absent(const K& key, Function mapping);
+    /*
+     * snapshot(): a private copy of all the pairs, taken one shard at a time
+     *  (each shard is copied as a whole, under its shared lock);
+     *  read and iterate it (get/containsKey/keys/values) without holding any lock
+     */
+    Snapshot snapshot();
+
+    int shardCount()
+    {
+        return nshards;
+    }
+    void println(string (*key2str)(K&) = 0, string (*value2str)(V&) = 0)
+    {
+        cout << toString(key2str, value2str) << endl;
+    }
+
+protected:
+    static int shardIndex(const K& key, int (*hashCode)(K&, int), int nshards)
+    {
+        uint32_t hash = hashMix32((uint32_t)hashCode(const_cast<K&>(key), HASH_RANGE));
+        return (int)(((uint64_t)hash * (uint32_t)nshards) >> 32);
+    }
+    Shard& shardOf(const K& key)
+    {
+        return shards[shardIndex(key, hashCode, nshards)];
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+public:
+    /*
+     * Shard: one xMap, its lock and its size; padded to whole cache lines so that
+     *  threads working on neighbouring shards do not share a line
+     */
+    class alignas(64) Shard
+    {
+    public:
+        shared_mutex lock;
+        xMap<K, V> map;
+        atomic<int> count;
+
+        Shard(int (*hashCode)(K&, int), float loadFactor,
+              bool (*valueEqual)(V&, V&), void (*deleteValues)(xMap<K, V>*),
+              bool (*keyEqual)(K&, K&), void (*deleteKeys)(xMap<K, V>*))
+            : map(hashCode, loadFactor, valueEqual, deleteValues, keyEqual, deleteKeys), count(0)
+        {
+            map.setPowerOfTwo(true);
+        }
+    };
+
+    /*
+     * Snapshot: read-only copy of a ConcurrentMap, one xMap per shard
+     */
+    class Snapshot
+    {
+    private:
+        xMap<K, V>** maps;
+        int nmaps;
+        int (*hashCode)(K&, int);
+        friend class ConcurrentMap<K, V>;
+
+        Snapshot(int nmaps, int (*hashCode)(K&, int)) : nmaps(nmaps), hashCode(hashCode)
+        {
+            maps = new xMap<K, V>*[nmaps]();
+        }
+
+    public:
+        Snapshot(Snapshot&& snapshot) : maps(snapshot.maps), nmaps(snapshot.nmaps), hashCode(snapshot.hashCode)
+        {
+            snapshot.maps = 0;
+            snapshot.nmaps = 0;
+        }
+        Snapshot(const Snapshot& snapshot) = delete;
+        Snapshot& operator=(const Snapshot& snapshot) = delete;
+        ~Snapshot()
+        {
+            for (int idx = 0; idx < nmaps; idx++)
+                delete maps[idx];
+            delete[] maps;
+        }
+
+        V& get(const K& key)
+        {
+            return maps[shardIndex(key, hashCode, nmaps)]->get(key);
+        }
+        bool containsKey(const K& key)
+        {
+            return maps[shardIndex(key, hashCode, nmaps)]->containsKey(key);
+        }
+        int size()
+        {
+            int total = 0;
+            for (int idx = 0; idx < nmaps; idx++)
+                total += maps[idx]->size();
+            return total;
+        }
+        bool empty()
+        {
+            return size() == 0;
+        }
+        DLinkedList<K> keys()
+        {
+            DLinkedList<K> keyList;
+            for (int idx = 0; idx < nmaps; idx++)
+            {
+                DLinkedList<K> shardKeys = maps[idx]->keys();
+                for (K& key : shardKeys)
+                    keyList.add(key);
+            }
+            return keyList;
+        }
+        DLinkedList<V> values()
+        {
+            DLinkedList<V> valueList;
+            for (int idx = 0; idx < nmaps; idx++)
+            {
+                DLinkedList<V> shardValues = maps[idx]->values();
+                for (V& value : shardValues)
+                    valueList.add(value);
+            }
+            return valueList;
+        }
+    };
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class K, class V>
+ConcurrentMap<K, V>::ConcurrentMap(
+    int (*hashCode)(K&, int),
+    float loadFactor,
+    bool (*valueEqual)(V&, V&),
+    void (*deleteValues)(xMap<K, V>*),
+    bool (*keyEqual)(K&, K&),
+    void (*deleteKeys)(xMap<K, V>*),
+    int nshards)
+{
+    this->hashCode = hashCode;
+    this->nshards = nshards < 1 ? 1 : nshards;
+    this->shards = (Shard*)::operator new(sizeof(Shard) * this->nshards, std::align_val_t(alignof(Shard)));
+    for (int idx = 0; idx < this->nshards; idx++)
+        new (&shards[idx]) Shard(hashCode, loadFactor, valueEqual, deleteValues, keyEqual, deleteKeys);
+}
+
+template <class K, class V>
+ConcurrentMap<K, V>::~ConcurrentMap()
+{
+    for (int idx = 0; idx < nshards; idx++)
+        shards[idx].~Shard();
+    ::operator delete(shards, std::align_val_t(alignof(Shard)));
+}
+
+template <class K, class V>
+V ConcurrentMap<K, V>::put(const K& key, const V& value)
+{
+    Shard& shard = shardOf(key);
+    unique_lock<shared_mutex> guard(shard.lock);
+    V result = shard.map.put(key, value);
+    shard.count.store(shard.map.size(), memory_order_relaxed);
+    return result;
+}
+
+template <class K, class V>
+V& ConcurrentMap<K, V>::get(const K& key)
+{
+    Shard& shard = shardOf(key);
+    shared_lock<shared_mutex> guard(shard.lock);
+    return shard.map.get(key);
+}
+
+template <class K, class V>
+bool ConcurrentMap<K, V>::tryGet(const K& key, V& value)
+{
+    Shard& shard = shardOf(key);
+    shared_lock<shared_mutex> guard(shard.lock);
+    if (!shard.map.containsKey(key))
+        return false;
+    value = shard.map.get(key);
+    return true;
+}
+
+template <class K, class V>
+template <class Function>
+V ConcurrentMap<K, V>::compute_if_absent(const K& key, Function mapping)
+{
+    Shard& shard = shardOf(key);
+    {
+        // fast path: the key is usually there already
+        shared_lock<shared_mutex> guard(shard.lock);
+        if (shard.map.containsKey(key))
+            return shard.map.get(key);
+    }
+    unique_lock<shared_mutex> guard(shard.lock);
+    if (shard.map.containsKey(key))
+        return shard.map.get(key); // another thread won the race
+    V value = mapping(key);
+    shard.map.put(key, value);
+    shard.count.store(shard.map.size(), memory_order_relaxed);
+    return value;
+}
+
+template <class K, class V>
+V ConcurrentMap<K, V>::remove(const K& key, void (*deleteKeyInMap)(K))
+{
+    Shard& shard = shardOf(key);
+    unique_lock<shared_mutex> guard(shard.lock);
+    V result = shard.map.remove(key, deleteKeyInMap);
+    shard.count.store(shard.map.size(), memory_order_relaxed);
+    return result;
+}
+
+template <class K, class V>
+bool ConcurrentMap<K, V>::remove(const K& key, const V& value, void (*deleteKeyInMap)(K), void (*deleteValueInMap)(V))
+{
+    Shard& shard = shardOf(key);
+    unique_lock<shared_mutex> guard(shard.lock);
+    bool removed = shard.map.remove(key, value, deleteKeyInMap, deleteValueInMap);
+    shard.count.store(shard.map.size(), memory_order_relaxed);
+    return removed;
+}
+
+template <class K, class V>
+bool ConcurrentMap<K, V>::containsKey(const K& key)
+{
+    Shard& shard = shardOf(key);
+    shared_lock<shared_mutex> guard(shard.lock);
+    return shard.map.containsKey(key);
+}
+
+template <class K, class V>
+bool ConcurrentMap<K, V>::containsValue(const V& value)
+{
+    for (int idx = 0; idx < nshards; idx++)
+    {
+        shared_lock<shared_mutex> guard(shards[idx].lock);
+        if (shards[idx].map.containsValue(value))
+            return true;
+    }
+    return false;
+}
+
+template <class K, class V>
+bool ConcurrentMap<K, V>::empty()
+{
+    return size() == 0;
+}
+
+template <class K, class V>
+int ConcurrentMap<K, V>::size()
+{
+    int total = 0;
+    for (int idx = 0; idx < nshards; idx++)
+        total += shards[idx].count.load(memory_order_relaxed);
+    return total;
+}
+
+template <class K, class V>
+void ConcurrentMap<K, V>::clear()
+{
+    for (int idx = 0; idx < nshards; idx++)
+    {
+        unique_lock<shared_mutex> guard(shards[idx].lock);
+        shards[idx].map.clear();
+        shards[idx].count.store(0, memory_order_relaxed);
+    }
+}
+
+template <class K, class V>
+string ConcurrentMap<K, V>::toString(string (*key2str)(K&), string (*value2str)(V&))
+{
+    stringstream os;
+    for (int idx = 0; idx < nshards; idx++)
+    {
+        shared_lock<shared_mutex> guard(shards[idx].lock);
+        os << "shard " << idx << ":" << endl;
+        os << shards[idx].map.toString(key2str, value2str);
+    }
+    return os.str();
+}
+
+template <class K, class V>
+DLinkedList<K> ConcurrentMap<K, V>::keys()
+{
+    DLinkedList<K> keyList;
+    for (int idx = 0; idx < nshards; idx++)
+    {
+        shared_lock<shared_mutex> guard(shards[idx].lock);
+        DLinkedList<K> shardKeys = shards[idx].map.keys();
+        for (K& key : shardKeys)
+            keyList.add(key);
+    }
+    return keyList;
+}
+
+template <class K, class V>
+DLinkedList<V> ConcurrentMap<K, V>::values()
+{
+    DLinkedList<V> valueList;
+    for (int idx = 0; idx < nshards; idx++)
+    {
+        shared_lock<shared_mutex> guard(shards[idx].lock);
+        DLinkedList<V> shardValues = shards[idx].map.values();
+        for (V& value : shardValues)
+            valueList.add(value);
+    }
+    return valueList;
+}
+
+/*
+ * clashes(): the clashes of every shard, shard after shard
+ */
+template <class K, class V>
+DLinkedList<int> ConcurrentMap<K, V>::clashes()
+{
+    DLinkedList<int> clashList;
+    for (int idx = 0; idx < nshards; idx++)
+    {
+        shared_lock<shared_mutex> guard(shards[idx].lock);
+        DLinkedList<int> shardClashes = shards[idx].map.clashes();
+        for (int size : shardClashes)
+            clashList.add(size);
+    }
+    return clashList;
+}
+
+template <class K, class V>
+typename ConcurrentMap<K, V>::Snapshot ConcurrentMap<K, V>::snapshot()
+{
+    Snapshot copy(nshards, hashCode);
+    for (int idx = 0; idx < nshards; idx++)
+    {
+        shared_lock<shared_mutex> guard(shards[idx].lock);
+        copy.maps[idx] = new xMap<K, V>(shards[idx].map);
+    }
+    return copy;
+}
+
+#endif /* CONCURRENTMAP_H */
@@ -0,0 +1,779 @@
+/*
+ * File:   FlatMap.h
+ *
+ * FlatMap<K, V>: open-addressing hash map
+ *  + keys and values live in one flat array of slots (no Entry, no list node per key)
+ *  + linear probing with Robin Hood insertion, deletion by backward shift (no tombstones)
+ *  + one control byte per slot (EMPTY, or 7 bits of the hash); a probe compares 16
+ *      control bytes at a time (SSE2 when available), keys are only compared on a match
+ */
+
+#ifndef FLATMAP_H
+#define FLATMAP_H
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <sstream>
+#include <new>
+#include <utility>
+#include <stdint.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+using namespace std;
+
+#include "list/DLinkedList.h"
+#include "hash/IMap.h"
+#include "hash/HashFunctions.h"
+
+/*
+ * FlatMap<K, V>:
+ *  + K: key type
+ *  + V: value type
+ *  + same hooks as xMap<K, V>; hashCode(key, tableSize) is called ONCE per operation
+ *      with tableSize = FlatMap::HASH_RANGE, the result is mixed into a 64-bit hash
+ *      that gives both the home slot and the control byte
+ *  For example:
+ *      FlatMap<string, int> map(&xMap<string, int>::stringKeyHash);
+ */
+template <class K, class V>
+class FlatMap : public IMap<K, V>
+{
+public:
+  class Slot; // forward declaration
+  static const int HASH_RANGE = 0x7FFFFFFF;
+  static const int GROUP = 16; // control bytes probed at once
+
+protected:
+  Slot *slots;       // capacity slots (raw storage, constructed when full)
+  int8_t *ctrl;      // capacity + GROUP control bytes: ctrl[capacity + i] mirrors ctrl[i]
+  uint32_t *hashes;  // low bits of the mixed hash of each full slot (home slot, rehash)
+  int capacity;      // power of two, >= GROUP
+  int count;
+  float loadFactor;  // grow when count > loadFactor * capacity
+  int (*hashCode)(K &, int);
+  typename KeyView<K>::Hash viewHashCode; // see xMap: hashCode for key views, 0 if none
+  bool (*keyEqual)(K &, K &);
+  bool (*valueEqual)(V &, V &);
+  void (*deleteKeys)(FlatMap<K, V> *);
+  void (*deleteValues)(FlatMap<K, V> *);
+
+  static const int8_t EMPTY = (int8_t)0x80;
+
+public:
+  FlatMap(
+      int (*hashCode)(K &, int), // require
+      float loadFactor = 0.875f,
+      bool (*valueEqual)(V &, V &) = 0,
+      void (*deleteValues)(FlatMap<K, V> *) = 0,
+      bool (*keyEqual)(K &, K &) = 0,
+      void (*deleteKeys)(FlatMap<K, V> *) = 0);
+  FlatMap(const FlatMap<K, V> &map);
+  FlatMap(FlatMap<K, V> &&map);
+  FlatMap<K, V> &operator=(const FlatMap<K, V> &map);
+  FlatMap<K, V> &operator=(FlatMap<K, V> &&map);
+  ~FlatMap();
+
+  // Inherit from IMap:BEGIN
+  V put(const K &key, const V &value);
+  V &get(const K &key);
+  V remove(const K &key, void (*deleteKeyInMap)(K) = 0);
+  bool remove(const K &key, const V &value, void (*deleteKeyInMap)(K) = 0, void (*deleteValueInMap)(V) = 0);
+  bool containsKey(const K &key);
+  bool containsValue(const V &value);
+  bool empty();
+  int size();
+  void clear();
+  string toString(string (*key2str)(K &) = 0, string (*value2str)(V &) = 0);
+  DLinkedList<K> keys();
+  DLinkedList<V> values();
+  /*
+   * clashes(): for each slot, the number of keys whose home slot it is
+   *  (the same meaning as the bucket sizes returned by xMap::clashes)
+   */
+  DLinkedList<int> clashes();
+  // Inherit from IMap:END
+
+  /*
+   * Lookups by key view (e.g. const char* or string_view for string keys), as in xMap;
+   *  the view hash is known for the hooks of hash/HashFunctions.h, others need setViewHash
+   */
+  template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type = 0>
+  V &get(const Q &key);
+  template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type = 0>
+  bool containsKey(const Q &key);
+  void setViewHash(typename KeyView<K>::Hash viewHashCode)
+  {
+    this->viewHashCode = viewHashCode;
+  }
+
+  void println(string (*key2str)(K &) = 0, string (*value2str)(V &) = 0)
+  {
+    cout << this->toString(key2str, value2str) << endl;
+  }
+  int getCapacity()
+  {
+    return capacity;
+  }
+  /*
+   * reserve(n): make room for n keys without rehashing
+   */
+  void reserve(int n)
+  {
+    int needed = capacityFor(n);
+    if (needed > capacity)
+      rehash(needed);
+  }
+
+  ///////////////////////////////////////////////////
+  // STATIC METHODS: BEGIN
+  ///////////////////////////////////////////////////
+  /*
+   * freeKey(FlatMap<K,V> *pMap), freeValue(FlatMap<K,V> *pMap):
+   *  delete the keys (values) stored in the map, when K (V) is a pointer type
+   */
+  static void freeKey(FlatMap<K, V> *pMap)
+  {
+    for (int idx = 0; idx < pMap->capacity; idx++)
+      if (pMap->ctrl[idx] != EMPTY)
+        delete pMap->slots[idx].key;
+  }
+  static void freeValue(FlatMap<K, V> *pMap)
+  {
+    for (int idx = 0; idx < pMap->capacity; idx++)
+      if (pMap->ctrl[idx] != EMPTY)
+        delete pMap->slots[idx].value;
+  }
+  ///////////////////////////////////////////////////
+  // STATIC METHODS: END
+  ///////////////////////////////////////////////////
+
+protected:
+  ////////////////////////////////////////////////////////
+  ////////////////////////  UTILITIES ////////////////////
+  ////////////////////////////////////////////////////////
+  /*
+   * hashOf(key): the user's hash spread over 64 bits (murmur3 finalizer),
+   *  so that weak hooks such as "key % tableSize" still fill the table evenly
+   */
+  uint64_t hashOf(const K &key)
+  {
+    return hashMix64((uint64_t)(uint32_t)hashCode(const_cast<K &>(key), HASH_RANGE));
+  }
+  static int8_t fingerprint(uint64_t hash)
+  {
+    return (int8_t)(hash >> 57); // top 7 bits: 0..127, never EMPTY
+  }
+  int home(uint32_t hash)
+  {
+    return (int)(hash & (uint32_t)(capacity - 1));
+  }
+  // distance of the key in "idx" from its home slot
+  int distance(int idx)
+  {
+    return (idx - home(hashes[idx])) & (capacity - 1);
+  }
+  int capacityFor(int n)
+  {
+    int cap = GROUP;
+    while (n > cap * loadFactor)
+      cap <<= 1;
+    return cap;
+  }
+  void setCtrl(int idx, int8_t value)
+  {
+    ctrl[idx] = value;
+    if (idx < GROUP)
+      ctrl[capacity + idx] = value;
+  }
+  /*
+   * matchByte(group, value), matchEmpty(group):
+   *  bit i of the result is set when group[i] == value (resp. EMPTY)
+   */
+  static unsigned matchByte(const int8_t *group, int8_t value)
+  {
+#if defined(__SSE2__)
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value)));
+#else
+    unsigned mask = 0;
+    for (int i = 0; i < GROUP; i++)
+      if (group[i] == value)
+        mask |= 1u << i;
+    return mask;
+#endif
+  }
+  static unsigned matchEmpty(const int8_t *group)
+  {
+#if defined(__SSE2__)
+    // EMPTY is the only control byte with the high bit set
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return (unsigned)_mm_movemask_epi8(bytes);
+#else
+    return matchByte(group, EMPTY);
+#endif
+  }
+  static int lowestBit(unsigned mask)
+  {
+    return __builtin_ctz(mask);
+  }
+
+  int find(const K &key, uint64_t hash);
+  int findView(typename KeyView<K>::type key);
+  void insertNew(K &&key, V &&value, uint64_t hash);
+  void eraseAt(int idx);
+  void rehash(int newCapacity);
+  void allocate(int newCapacity);
+  void destroyAll();
+  void copyFrom(const FlatMap<K, V> &map);
+  void removeInternalData();
+
+  bool keyEQ(const K &lhs, const K &rhs)
+  {
+    if (keyEqual != 0)
+      return keyEqual(const_cast<K &>(lhs), const_cast<K &>(rhs));
+    else
+      return lhs == rhs;
+  }
+  bool valueEQ(const V &lhs, const V &rhs)
+  {
+    if (valueEqual != 0)
+      return valueEqual(const_cast<V &>(lhs), const_cast<V &>(rhs));
+    else
+      return lhs == rhs;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+  //////////////////////////////////////////////////////////////////////
+public:
+  // Slot: BEGIN
+  class Slot
+  {
+  private:
+    K key;
+    V value;
+    friend class FlatMap<K, V>;
+
+  public:
+    Slot(K &&key, V &&value) : key(std::move(key)), value(std::move(value)) {}
+  };
+  // Slot: END
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class K, class V>
+FlatMap<K, V>::FlatMap(
+    int (*hashCode)(K &, int),
+    float loadFactor,
+    bool (*valueEqual)(V &lhs, V &rhs),
+    void (*deleteValues)(FlatMap<K, V> *),
+    bool (*keyEqual)(K &lhs, K &rhs),
+    void (*deleteKeys)(FlatMap<K, V> *pMap))
+{
+  this->hashCode = hashCode;
+  this->viewHashCode = KeyView<K>::viewHash(hashCode);
+  this->loadFactor = loadFactor;
+  this->valueEqual = valueEqual;
+  this->deleteValues = deleteValues;
+  this->keyEqual = keyEqual;
+  this->deleteKeys = deleteKeys;
+  this->count = 0;
+  allocate(GROUP);
+}
+
+template <class K, class V>
+FlatMap<K, V>::FlatMap(const FlatMap<K, V> &map)
+{
+  this->hashCode = map.hashCode;
+  this->viewHashCode = map.viewHashCode;
+  this->loadFactor = map.loadFactor;
+  this->valueEqual = map.valueEqual;
+  this->keyEqual = map.keyEqual;
+  // as in xMap: a copy never deletes the user's keys/values
+  this->deleteKeys = 0;
+  this->deleteValues = 0;
+  this->count = 0;
+  allocate(map.capacity);
+  copyFrom(map);
+}
+
+template <class K, class V>
+FlatMap<K, V>::FlatMap(FlatMap<K, V> &&map)
+{
+  this->hashCode = map.hashCode;
+  this->viewHashCode = map.viewHashCode;
+  this->loadFactor = map.loadFactor;
+  this->valueEqual = map.valueEqual;
+  this->keyEqual = map.keyEqual;
+  this->deleteKeys = map.deleteKeys;
+  this->deleteValues = map.deleteValues;
+  this->slots = map.slots;
+  this->ctrl = map.ctrl;
+  this->hashes = map.hashes;
+  this->capacity = map.capacity;
+  this->count = map.count;
+
+  // leave "map" empty but usable
+  map.deleteKeys = 0;
+  map.deleteValues = 0;
+  map.count = 0;
+  map.allocate(GROUP);
+}
+
+template <class K, class V>
+FlatMap<K, V> &FlatMap<K, V>::operator=(const FlatMap<K, V> &map)
+{
+  if (this == &map)
+    return *this;
+  removeInternalData();
+  this->hashCode = map.hashCode;
+  this->viewHashCode = map.viewHashCode;
+  this->loadFactor = map.loadFactor;
+  this->valueEqual = map.valueEqual;
+  this->keyEqual = map.keyEqual;
+  this->deleteKeys = 0;
+  this->deleteValues = 0;
+  this->count = 0;
+  allocate(map.capacity);
+  copyFrom(map);
+  return *this;
+}
+
+template <class K, class V>
+FlatMap<K, V> &FlatMap<K, V>::operator=(FlatMap<K, V> &&map)
+{
+  if (this == &map)
+    return *this;
+  removeInternalData();
+  this->hashCode = map.hashCode;
+  this->viewHashCode = map.viewHashCode;
+  this->loadFactor = map.loadFactor;
+  this->valueEqual = map.valueEqual;
+  this->keyEqual = map.keyEqual;
+  this->deleteKeys = map.deleteKeys;
+  this->deleteValues = map.deleteValues;
+  this->slots = map.slots;
+  this->ctrl = map.ctrl;
+  this->hashes = map.hashes;
+  this->capacity = map.capacity;
+  this->count = map.count;
+
+  map.deleteKeys = 0;
+  map.deleteValues = 0;
+  map.count = 0;
+  map.allocate(GROUP);
+  return *this;
+}
+
+template <class K, class V>
+FlatMap<K, V>::~FlatMap()
+{
+  removeInternalData();
+}
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// IMPLEMENTATION of IMap    ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class K, class V>
+V FlatMap<K, V>::put(const K &key, const V &value)
+{
+  uint64_t hash = hashOf(key);
+  int idx = find(key, hash);
+  if (idx >= 0)
+  {
+    V oldValue = slots[idx].value;
+    slots[idx].value = value;
+    return oldValue;
+  }
+  // copy before rehash: key and value may be references into this map's slots
+  K newKey(key);
+  V newValue(value), retValue(value);
+  if (count + 1 > capacity * loadFactor)
+    rehash(capacity * 2);
+  insertNew(std::move(newKey), std::move(newValue), hash);
+  return retValue;
+}
+
+template <class K, class V>
+V &FlatMap<K, V>::get(const K &key)
+{
+  int idx = find(key, hashOf(key));
+  if (idx < 0)
+  {
+    stringstream os;
+    os << "key (" << key << ") is not found";
+    throw KeyNotFound(os.str());
+  }
+  return slots[idx].value;
+}
+
+template <class K, class V>
+V FlatMap<K, V>::remove(const K &key, void (*deleteKeyInMap)(K))
+{
+  int idx = find(key, hashOf(key));
+  if (idx < 0)
+  {
+    stringstream os;
+    os << "key (" << key << ") is not found";
+    throw KeyNotFound(os.str());
+  }
+  V retValue = slots[idx].value;
+  if (deleteKeyInMap != 0)
+    deleteKeyInMap(slots[idx].key);
+  eraseAt(idx);
+  return retValue;
+}
+
+template <class K, class V>
+bool FlatMap<K, V>::remove(const K &key, const V &value, void (*deleteKeyInMap)(K), void (*deleteValueInMap)(V))
+{
+  int idx = find(key, hashOf(key));
+  if (idx < 0 || !valueEQ(slots[idx].value, value))
+    return false;
+  if (deleteKeyInMap != 0)
+    deleteKeyInMap(slots[idx].key);
+  if (deleteValueInMap != 0)
+    deleteValueInMap(slots[idx].value);
+  eraseAt(idx);
+  return true;
+}
+
+template <class K, class V>
+bool FlatMap<K, V>::containsKey(const K &key)
+{
+  return find(key, hashOf(key)) >= 0;
+}
+
+template <class K, class V>
+template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type>
+V &FlatMap<K, V>::get(const Q &key)
+{
+  typename KeyView<K>::type view(key);
+  int idx = findView(view);
+  if (idx < 0)
+  {
+    stringstream os;
+    os << "key (" << view << ") is not found";
+    throw KeyNotFound(os.str());
+  }
+  return slots[idx].value;
+}
+
+template <class K, class V>
+template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type>
+bool FlatMap<K, V>::containsKey(const Q &key)
+{
+  return findView(typename KeyView<K>::type(key)) >= 0;
+}
+
+template <class K, class V>
+bool FlatMap<K, V>::containsValue(const V &value)
+{
+  for (int idx = 0; idx < capacity; idx++)
+    if (ctrl[idx] != EMPTY && valueEQ(slots[idx].value, value))
+      return true;
+  return false;
+}
+
+template <class K, class V>
+bool FlatMap<K, V>::empty()
+{
+  return count == 0;
+}
+
+template <class K, class V>
+int FlatMap<K, V>::size()
+{
+  return count;
+}
+
+template <class K, class V>
+void FlatMap<K, V>::clear()
+{
+  removeInternalData();
+  count = 0;
+  allocate(GROUP);
+}
+
+template <class K, class V>
+DLinkedList<K> FlatMap<K, V>::keys()
+{
+  DLinkedList<K> keyList;
+  for (int idx = 0; idx < capacity; idx++)
+    if (ctrl[idx] != EMPTY)
+      keyList.add(slots[idx].key);
+  return keyList;
+}
+
+template <class K, class V>
+DLinkedList<V> FlatMap<K, V>::values()
+{
+  DLinkedList<V> valueList;
+  for (int idx = 0; idx < capacity; idx++)
+    if (ctrl[idx] != EMPTY)
+      valueList.add(slots[idx].value);
+  return valueList;
+}
+
+template <class K, class V>
+DLinkedList<int> FlatMap<K, V>::clashes()
+{
+  int *homes = new int[capacity]();
+  for (int idx = 0; idx < capacity; idx++)
+    if (ctrl[idx] != EMPTY)
+      homes[home(hashes[idx])]++;
+  DLinkedList<int> clashList(homes, homes + capacity);
+  delete[] homes;
+  return clashList;
+}
+
+template <class K, class V>
+string FlatMap<K, V>::toString(string (*key2str)(K &), string (*value2str)(V &))
+{
+  stringstream os;
+  string mark(50, '=');
+  os << mark << endl;
+  os << setw(12) << left << "capacity: " << capacity << endl;
+  os << setw(12) << left << "size: " << count << endl;
+  for (int idx = 0; idx < capacity; idx++)
+  {
+    os << setw(4) << left << idx << ": ";
+    if (ctrl[idx] != EMPTY)
+    {
+      os << " (";
+      if (key2str != 0)
+        os << key2str(slots[idx].key);
+      else
+        os << slots[idx].key;
+      os << ",";
+      if (value2str != 0)
+        os << value2str(slots[idx].value);
+      else
+        os << slots[idx].value;
+      os << ")";
+    }
+    os << endl;
+  }
+  os << mark << endl;
+  return os.str();
+}
+
+////////////////////////////////////////////////////////
+//                  UTILITIES
+////////////////////////////////////////////////////////
+
+/*
+ * find(key, hash): index of the slot holding "key", or -1
+ *  + the keys of one home slot form an unbroken run of full slots starting there,
+ *      so the probe stops at the first group that contains an EMPTY byte
+ */
+template <class K, class V>
+int FlatMap<K, V>::find(const K &key, uint64_t hash)
+{
+  int8_t h2 = fingerprint(hash);
+  int mask = capacity - 1;
+  int pos = home((uint32_t)hash);
+  for (int probed = 0; probed < capacity; probed += GROUP)
+  {
+    const int8_t *group = ctrl + pos;
+    for (unsigned match = matchByte(group, h2); match != 0; match &= match - 1)
+    {
+      int idx = (pos + lowestBit(match)) & mask;
+      if (keyEQ(slots[idx].key, key))
+        return idx;
+    }
+    if (matchEmpty(group) != 0)
+      return -1;
+    pos = (pos + GROUP) & mask;
+  }
+  return -1;
+}
+
+/*
+ * findView(key): find() for a key view, hashed with viewHashCode and compared with ==;
+ *  without a view hash (or with a keyEqual hook) the view is converted to K
+ */
+template <class K, class V>
+int FlatMap<K, V>::findView(typename KeyView<K>::type key)
+{
+  if (viewHashCode == 0 || keyEqual != 0)
+  {
+    K tmp(key);
+    return find(tmp, hashOf(tmp));
+  }
+  uint64_t hash = hashMix64((uint64_t)(uint32_t)viewHashCode(key, HASH_RANGE));
+  int8_t h2 = fingerprint(hash);
+  int mask = capacity - 1;
+  int pos = home((uint32_t)hash);
+  for (int probed = 0; probed < capacity; probed += GROUP)
+  {
+    const int8_t *group = ctrl + pos;
+    for (unsigned match = matchByte(group, h2); match != 0; match &= match - 1)
+    {
+      int idx = (pos + lowestBit(match)) & mask;
+      if (slots[idx].key == key)
+        return idx;
+    }
+    if (matchEmpty(group) != 0)
+      return -1;
+    pos = (pos + GROUP) & mask;
+  }
+  return -1;
+}
+
+/*
+ * insertNew(key, value, hash): Robin Hood insertion of a key known to be absent;
+ *  walking from the home slot, the carried entry takes the place of any resident that is
+ *  closer to its own home, and the resident is carried on
+ */
+template <class K, class V>
+void FlatMap<K, V>::insertNew(K &&key, V &&value, uint64_t hash)
+{
+  int mask = capacity - 1;
+  uint32_t carryHash = (uint32_t)hash;
+  int8_t carryCtrl = fingerprint(hash);
+  int idx = home(carryHash);
+  int dist = 0;
+
+  // the carried entry is held in a slot-sized buffer, so resident entries can be swapped out
+  typename std::aligned_storage<sizeof(Slot), alignof(Slot)>::type carryStorage;
+  Slot *carry = new (&carryStorage) Slot(std::move(key), std::move(value));
+  while (true)
+  {
+    if (ctrl[idx] == EMPTY)
+    {
+      new (&slots[idx]) Slot(std::move(carry->key), std::move(carry->value));
+      hashes[idx] = carryHash;
+      setCtrl(idx, carryCtrl);
+      break;
+    }
+    int residentDist = distance(idx);
+    if (residentDist < dist)
+    {
+      std::swap(carry->key, slots[idx].key);
+      std::swap(carry->value, slots[idx].value);
+      std::swap(carryHash, hashes[idx]);
+      int8_t residentCtrl = ctrl[idx];
+      setCtrl(idx, carryCtrl);
+      carryCtrl = residentCtrl;
+      dist = residentDist;
+    }
+    idx = (idx + 1) & mask;
+    dist++;
+  }
+  carry->~Slot();
+  count++;
+}
+
+/*
+ * eraseAt(idx): backward-shift deletion; the entries after "idx" that are not in their
+ *  home slot move one step back, so no tombstone is needed
+ */
+template <class K, class V>
+void FlatMap<K, V>::eraseAt(int idx)
+{
+  int mask = capacity - 1;
+  slots[idx].~Slot();
+  int next = (idx + 1) & mask;
+  while (ctrl[next] != EMPTY && distance(next) > 0)
+  {
+    new (&slots[idx]) Slot(std::move(slots[next].key), std::move(slots[next].value));
+    slots[next].~Slot();
+    hashes[idx] = hashes[next];
+    setCtrl(idx, ctrl[next]);
+    idx = next;
+    next = (next + 1) & mask;
+  }
+  setCtrl(idx, EMPTY);
+  count--;
+}
+
+/*
+ * rehash(newCapacity): move every entry to a new table, using the stored hashes
+ *  (the hashCode hook is not called again)
+ */
+template <class K, class V>
+void FlatMap<K, V>::rehash(int newCapacity)
+{
+  Slot *oldSlots = slots;
+  int8_t *oldCtrl = ctrl;
+  uint32_t *oldHashes = hashes;
+  int oldCapacity = capacity;
+
+  allocate(newCapacity);
+  count = 0;
+  for (int idx = 0; idx < oldCapacity; idx++)
+  {
+    if (oldCtrl[idx] == EMPTY)
+      continue;
+    // rebuild the 64-bit hash: low 32 bits were stored, the control byte holds the top 7
+    uint64_t hash = ((uint64_t)(uint8_t)oldCtrl[idx] << 57) | oldHashes[idx];
+    insertNew(std::move(oldSlots[idx].key), std::move(oldSlots[idx].value), hash);
+    oldSlots[idx].~Slot();
+  }
+  ::operator delete(oldSlots);
+  delete[] oldCtrl;
+  delete[] oldHashes;
+}
+
+template <class K, class V>
+void FlatMap<K, V>::allocate(int newCapacity)
+{
+  capacity = newCapacity;
+  slots = static_cast<Slot *>(::operator new(sizeof(Slot) * capacity));
+  ctrl = new int8_t[capacity + GROUP];
+  hashes = new uint32_t[capacity];
+  for (int idx = 0; idx < capacity + GROUP; idx++)
+    ctrl[idx] = EMPTY;
+}
+
+template <class K, class V>
+void FlatMap<K, V>::destroyAll()
+{
+  for (int idx = 0; idx < capacity; idx++)
+    if (ctrl[idx] != EMPTY)
+      slots[idx].~Slot();
+}
+
+template <class K, class V>
+void FlatMap<K, V>::copyFrom(const FlatMap<K, V> &map)
+{
+  // same capacity: every entry keeps its slot
+  for (int idx = 0; idx < capacity; idx++)
+  {
+    if (map.ctrl[idx] == EMPTY)
+      continue;
+    K key = map.slots[idx].key;
+    V value = map.slots[idx].value;
+    new (&slots[idx]) Slot(std::move(key), std::move(value));
+  }
+  for (int idx = 0; idx < capacity + GROUP; idx++)
+    ctrl[idx] = map.ctrl[idx];
+  for (int idx = 0; idx < capacity; idx++)
+    hashes[idx] = map.hashes[idx];
+  count = map.count;
+}
+
+/*
+ * removeInternalData: delete the user's keys/values if required, destroy the slots,
+ *  free the arrays
+ */
+template <class K, class V>
+void FlatMap<K, V>::removeInternalData()
+{
+  if (deleteKeys != 0)
+    deleteKeys(this);
+  if (deleteValues != 0)
+    deleteValues(this);
+  destroyAll();
+  ::operator delete(slots);
+  delete[] ctrl;
+  delete[] hashes;
+}
+
+#endif /* FLATMAP_H */
@@ -0,0 +1,290 @@
+/*
+ * File:   FrozenMap.h
+ *
+ * FrozenMap<K, V>: a read-only hash table stored in a file and used in place
+ *  + FrozenMap<K, V>::freeze(map, filename): write the pairs of an xMap to an image
+ *  + FrozenMap<K, V> frozen(filename): mmap the image; get/containsKey/find read the
+ *      mapped pages directly: nothing is parsed at open, no heap allocation per lookup
+ *  For example:
+ *      xMap<string, int> vocab(&xMap<string, int>::stringKeyHash);
+ *      ... fill vocab once ...
+ *      FrozenMap<string, int>::freeze(vocab, "vocab.map");
+ *      // at every start:
+ *      FrozenMap<string, int> frozen("vocab.map");
+ *      int id = frozen.get("hello");
+ *
+ *  K: a trivially copyable type (compared and hashed by its bytes, so it must not
+ *      contain padding) or string (looked up by string, string_view or const char*)
+ *  V: a trivially copyable type
+ *  The image is in the byte order of the machine that wrote it.
+ */
+
+#ifndef FROZENMAP_H
+#define FROZENMAP_H
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+using namespace std;
+
+#include "hash/IMap.h"
+#include "hash/xMap.h"
+#include "hash/HashFunctions.h"
+
+/*
+ * Image layout (all offsets from the start of the file, sections aligned to 16 bytes):
+ *  + FrozenMapHeader
+ *  + slots[slotCount]: open addressing with linear probing, slotCount is a power of two
+ *      (load factor <= 0.75); a slot holds the value, so a hit reads two places only:
+ *      the slot and the key bytes
+ *  + keyBytes: the bytes of all the keys, one after the other
+ */
+struct FrozenMapHeader
+{
+  char magic[8];      // "XMAPFRZ1"
+  uint32_t keySize;   // sizeof(K), 0 for string keys
+  uint32_t valueSize; // sizeof(V)
+  uint32_t slotSize;  // sizeof(FrozenMap<K, V>::Slot)
+  uint32_t reserved;
+  uint64_t count;
+  uint64_t slotCount;
+  uint64_t slotsOffset;
+  uint64_t keyBytesOffset;
+  uint64_t fileSize;
+};
+
+template <class K, class V>
+class FrozenMap
+{
+  static_assert(is_trivially_copyable<K>::value || is_same<K, string>::value,
+                "FrozenMap: K must be trivially copyable or string");
+  static_assert(is_trivially_copyable<V>::value, "FrozenMap: V must be trivially copyable");
+
+public:
+  struct Slot
+  {
+    uint32_t tag;       // hash >> 32
+    uint32_t keyLength; // EMPTY: no key
+    uint64_t keyOffset; // the key is keyBytes[keyOffset .. keyOffset + keyLength)
+    V value;
+  };
+  static const uint32_t EMPTY = 0xFFFFFFFF;
+
+protected:
+  const char *image; // the mapped file
+  size_t imageSize;
+  const FrozenMapHeader *header;
+  const Slot *slots;
+  const char *keyBytes;
+  uint64_t mask; // slotCount - 1
+
+public:
+  FrozenMap(string filename);
+  FrozenMap(const FrozenMap<K, V> &map) = delete;
+  FrozenMap<K, V> &operator=(const FrozenMap<K, V> &map) = delete;
+  ~FrozenMap();
+
+  /*
+   * freeze(map, filename): write all the pairs of map to filename (replaced if it exists)
+   */
+  static void freeze(xMap<K, V> &map, string filename);
+
+  /*
+   * find(key): pointer to the value of key in the image, 0 if absent
+   * get(key): the value of key; KeyNotFound if absent
+   * containsKey(key): key is in the map
+   *  For string keys, "key" can also be a string_view or a const char*.
+   */
+  template <class Q>
+  const V *find(const Q &key);
+  template <class Q>
+  const V &get(const Q &key);
+  template <class Q>
+  bool containsKey(const Q &key)
+  {
+    return find(key) != 0;
+  }
+  int size()
+  {
+    return (int)header->count;
+  }
+  bool empty()
+  {
+    return header->count == 0;
+  }
+
+protected:
+  /*
+   * bytesOf(key): the bytes that are hashed and compared, the same for
+   *  a string and its views
+   */
+  static string_view bytesOf(const string &key)
+  {
+    return string_view(key);
+  }
+  static string_view bytesOf(string_view key)
+  {
+    return key;
+  }
+  static string_view bytesOf(const char *key)
+  {
+    return string_view(key);
+  }
+  template <class Q>
+  static string_view bytesOf(const Q &key)
+  {
+    static_assert(is_same<Q, K>::value, "FrozenMap: lookup with a key of another type");
+    return string_view((const char *)&key, sizeof(K));
+  }
+  static uint64_t hashOf(string_view bytes)
+  {
+    return wyhashBytes(bytes.data(), bytes.length());
+  }
+  static uint64_t align16(uint64_t offset)
+  {
+    return (offset + 15) & ~(uint64_t)15;
+  }
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class K, class V>
+FrozenMap<K, V>::FrozenMap(string filename)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw runtime_error("FrozenMap: cannot open " + filename);
+  struct stat info;
+  if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(FrozenMapHeader))
+  {
+    close(fd);
+    throw runtime_error("FrozenMap: " + filename + " is not a frozen map");
+  }
+  imageSize = info.st_size;
+  void *addr = mmap(0, imageSize, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd); // the mapping stays valid
+  if (addr == MAP_FAILED)
+    throw runtime_error("FrozenMap: cannot map " + filename);
+  image = (const char *)addr;
+
+  header = (const FrozenMapHeader *)image;
+  uint32_t keySize = is_same<K, string>::value ? 0 : sizeof(K);
+  if (memcmp(header->magic, "XMAPFRZ1", 8) != 0 || header->keySize != keySize ||
+      header->valueSize != sizeof(V) || header->slotSize != sizeof(Slot) ||
+      header->fileSize != imageSize || header->slotCount == 0 ||
+      (header->slotCount & (header->slotCount - 1)) != 0 ||
+      header->count * 4 > header->slotCount * 3 || // find() needs an EMPTY slot to stop a miss
+      header->slotsOffset + header->slotCount * sizeof(Slot) > header->keyBytesOffset ||
+      header->keyBytesOffset > imageSize)
+  {
+    munmap((void *)image, imageSize);
+    throw runtime_error("FrozenMap: " + filename + " is not a frozen map of these types");
+  }
+  slots = (const Slot *)(image + header->slotsOffset);
+  keyBytes = image + header->keyBytesOffset;
+  mask = header->slotCount - 1;
+}
+
+template <class K, class V>
+FrozenMap<K, V>::~FrozenMap()
+{
+  munmap((void *)image, imageSize);
+}
+
+template <class K, class V>
+void FrozenMap<K, V>::freeze(xMap<K, V> &map, string filename)
+{
+  uint64_t count = map.size(), slotCount = 16;
+  while (slotCount * 3 < count * 4)
+    slotCount <<= 1;
+
+  Slot empty;
+  memset(&empty, 0, sizeof(empty));
+  empty.keyLength = EMPTY;
+  vector<Slot> slotTable(slotCount, empty);
+  string bytes;
+  for (auto &entry : map)
+  {
+    string_view key = bytesOf(entry.getKey());
+    uint64_t hash = hashOf(key);
+    uint64_t pos = hash & (slotCount - 1);
+    while (slotTable[pos].keyLength != EMPTY)
+      pos = (pos + 1) & (slotCount - 1);
+    slotTable[pos].tag = (uint32_t)(hash >> 32);
+    slotTable[pos].keyLength = (uint32_t)key.length();
+    slotTable[pos].keyOffset = bytes.length();
+    slotTable[pos].value = entry.getValue();
+    bytes.append(key.data(), key.length());
+  }
+
+  FrozenMapHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, "XMAPFRZ1", 8);
+  header.keySize = is_same<K, string>::value ? 0 : sizeof(K);
+  header.valueSize = sizeof(V);
+  header.slotSize = sizeof(Slot);
+  header.count = count;
+  header.slotCount = slotCount;
+  header.slotsOffset = align16(sizeof(header));
+  header.keyBytesOffset = align16(header.slotsOffset + slotCount * sizeof(Slot));
+  header.fileSize = header.keyBytesOffset + bytes.length();
+
+  ofstream out(filename, ios::binary | ios::trunc);
+  if (!out.is_open())
+    throw runtime_error("FrozenMap: cannot write " + filename);
+  auto writeAt = [&](uint64_t offset, const void *data, size_t length) {
+    static const char zeros[16] = {0};
+    out.write(zeros, offset - (uint64_t)out.tellp()); // padding up to the section
+    out.write((const char *)data, length);
+  };
+  writeAt(0, &header, sizeof(header));
+  writeAt(header.slotsOffset, slotTable.data(), slotCount * sizeof(Slot));
+  writeAt(header.keyBytesOffset, bytes.data(), bytes.length());
+  out.close();
+  if (!out)
+    throw runtime_error("FrozenMap: cannot write " + filename);
+}
+
+template <class K, class V>
+template <class Q>
+const V *FrozenMap<K, V>::find(const Q &key)
+{
+  string_view bytes = bytesOf(key);
+  uint64_t hash = hashOf(bytes);
+  uint32_t tag = (uint32_t)(hash >> 32);
+  for (uint64_t pos = hash & mask;; pos = (pos + 1) & mask)
+  {
+    const Slot &slot = slots[pos];
+    if (slot.keyLength == EMPTY)
+      return 0;
+    if (slot.tag == tag && slot.keyLength == bytes.length() &&
+        memcmp(keyBytes + slot.keyOffset, bytes.data(), bytes.length()) == 0)
+      return &slot.value;
+  }
+}
+
+template <class K, class V>
+template <class Q>
+const V &FrozenMap<K, V>::get(const Q &key)
+{
+  const V *value = find(key);
+  if (value != 0)
+    return *value;
+  stringstream os;
+  os << "key (" << key << ") is not found";
+  throw KeyNotFound(os.str());
+}
+
+#endif /* FROZENMAP_H */
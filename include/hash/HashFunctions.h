@@ -0,0 +1,280 @@
+/*
+ * File:   HashFunctions.h
+ *
+ * Hash functions for the hash maps (xMap, FlatMap):
+ *  + byte hashes: wyhashBytes (fast, well mixed), fnv1aBytes (simple, byte at a time)
+ *  + integer mixers: hashMix64/hashMix32 (murmur3 finalizers)
+ *  + hooks with the map signature "int hashCode(K& key, int tableSize)";
+ *      pick one per map when constructing it, e.g.
+ *          xMap<string, int> map(&wyStringHash);
+ *          xMap<int, int> map(&mixIntHash);
+ *  + KeyView<K>: the key views a map accepts in lookups (string_view for string keys),
+ *      with the view version of each string hook (wyViewHash, ...)
+ */
+
+#ifndef HASHFUNCTIONS_H
+#define HASHFUNCTIONS_H
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+using namespace std;
+
+/*
+ * hashMix64(x), hashMix32(x): murmur3 finalizers; every input bit affects every output bit
+ */
+inline uint64_t hashMix64(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+inline uint32_t hashMix32(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x85ebca6bU;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35U;
+    x ^= x >> 16;
+    return x;
+}
+
+/*
+ * hashMum(a, b): 64x64 -> 128-bit multiply, folded to 64 bits (low ^ high)
+ */
+inline uint64_t hashMum(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+    uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32), c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    return lo ^ hi;
+#endif
+}
+
+inline uint64_t hashRead8(const uint8_t *p)
+{
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return v;
+}
+inline uint64_t hashRead4(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+/*
+ * wyhashBytes(data, len, seed): wyhash (final version 4 layout);
+ *  short keys (<= 16 bytes) cost two multiplications, longer keys 16/48 bytes per step
+ */
+inline uint64_t wyhashBytes(const void *data, size_t len, uint64_t seed = 0)
+{
+    static const uint64_t secret[4] = {
+        0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+        0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+    const uint8_t *p = (const uint8_t *)data;
+    seed ^= hashMum(seed ^ secret[0], secret[1]);
+    uint64_t a, b;
+    if (len <= 16)
+    {
+        if (len >= 4)
+        {
+            a = (hashRead4(p) << 32) | hashRead4(p + ((len >> 3) << 2));
+            b = (hashRead4(p + len - 4) << 32) | hashRead4(p + len - 4 - ((len >> 3) << 2));
+        }
+        else if (len > 0)
+        {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8) | p[len - 1];
+            b = 0;
+        }
+        else
+            a = b = 0;
+    }
+    else
+    {
+        size_t i = len;
+        if (i > 48)
+        {
+            uint64_t see1 = seed, see2 = seed;
+            do
+            {
+                seed = hashMum(hashRead8(p) ^ secret[1], hashRead8(p + 8) ^ seed);
+                see1 = hashMum(hashRead8(p + 16) ^ secret[2], hashRead8(p + 24) ^ see1);
+                see2 = hashMum(hashRead8(p + 32) ^ secret[3], hashRead8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16)
+        {
+            seed = hashMum(hashRead8(p) ^ secret[1], hashRead8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = hashRead8(p + i - 16);
+        b = hashRead8(p + i - 8);
+    }
+    a ^= secret[1];
+    b ^= seed;
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)a * b;
+    a = (uint64_t)r;
+    b = (uint64_t)(r >> 64);
+#else
+    uint64_t folded = hashMum(a, b);
+    a = folded;
+    b = hashMix64(folded);
+#endif
+    return hashMum(a ^ secret[0] ^ len, b ^ secret[1]);
+}
+
+/*
+ * fnv1aBytes(data, len): 64-bit FNV-1a
+ */
+inline uint64_t fnv1aBytes(const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < len; i++)
+    {
+        h ^= p[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+/*
+ * reduceHash(hash, tableSize): map a 64-bit hash to [0, tableSize) with a multiply
+ *  (uses the high bits, works for any tableSize, no division)
+ */
+inline int reduceHash(uint64_t hash, int tableSize)
+{
+    return (int)(((hash >> 32) * (uint64_t)(uint32_t)tableSize) >> 32);
+}
+
+///////////////////////////////////////////////////
+// HOOKS: int hashCode(K& key, int tableSize)
+///////////////////////////////////////////////////
+
+/*
+ * the string hooks hash the characters only, so each one has a view version
+ *  (xxxViewHash) that gives the same result for a string_view or a const char*
+ */
+inline int wyViewHash(string_view key, int tableSize)
+{
+    return reduceHash(wyhashBytes(key.data(), key.length()), tableSize);
+}
+inline int fnv1aViewHash(string_view key, int tableSize)
+{
+    return reduceHash(hashMix64(fnv1aBytes(key.data(), key.length())), tableSize);
+}
+inline int sumViewHash(string_view key, int tableSize)
+{
+    long long int sum = 0;
+    for (size_t idx = 0; idx < key.length(); idx++)
+        sum += (unsigned char)key[idx];  // a plain char may be negative
+    return sum % tableSize;
+}
+
+inline int wyStringHash(string &key, int tableSize)
+{
+    return wyViewHash(key, tableSize);
+}
+inline int fnv1aStringHash(string &key, int tableSize)
+{
+    return fnv1aViewHash(key, tableSize);
+}
+/*
+ * sumStringHash: sum of the character codes (the original xMap::stringKeyHash);
+ *  anagrams and keys such as "FC_1_W"/"FC_1_b" differ only slightly and crowd together
+ */
+inline int sumStringHash(string &key, int tableSize)
+{
+    return sumViewHash(key, tableSize);
+}
+
+inline int mixIntHash(int &key, int tableSize)
+{
+    return reduceHash(hashMix64((uint64_t)(uint32_t)key), tableSize);
+}
+/*
+ * moduloIntHash: key % tableSize (the original xMap::intKeyHash); keys must be >= 0,
+ *  strided keys (multiples of a divisor of tableSize) share a few buckets
+ */
+inline int moduloIntHash(int &key, int tableSize)
+{
+    return key % tableSize;
+}
+
+///////////////////////////////////////////////////
+// KEY VIEWS: lookups without a temporary key
+///////////////////////////////////////////////////
+
+/*
+ * KeyView<K>:
+ *  + type: what a map with keys of type K also accepts in get/containsKey/remove
+ *      (anything convertible to it, e.g. const char* and string_view for string keys);
+ *      NoKeyView (not constructible) when K has no view
+ *  + Hash: hook hashing a view, it must agree with the map's hashCode on equal keys
+ *  + viewHash(hook): the view version of a known hook, 0 if there is none
+ *      (the map then builds a temporary K, or use the map's setViewHash)
+ */
+class NoKeyView
+{
+private:
+    NoKeyView() {}
+};
+
+template <class K>
+struct KeyView
+{
+    typedef NoKeyView type;
+    typedef int (*Hash)(type, int);
+    static Hash viewHash(int (*)(K &, int))
+    {
+        return 0;
+    }
+};
+
+template <>
+struct KeyView<string>
+{
+    typedef string_view type;
+    typedef int (*Hash)(type, int);
+    static Hash viewHash(int (*hook)(string &, int))
+    {
+        if (hook == &wyStringHash)
+            return &wyViewHash;
+        if (hook == &fnv1aStringHash)
+            return &fnv1aViewHash;
+        if (hook == &sumStringHash)
+            return &sumViewHash;
+        return 0;
+    }
+};
+
+/*
+ * IsKeyView<Q, K>::value: a Q is looked up as a view in a map with keys of type K
+ */
+template <class Q, class K>
+struct IsKeyView
+{
+    static const bool value = is_convertible<const Q &, typename KeyView<K>::type>::value &&
+                              !is_same<Q, K>::value;
+};
+
+#endif /* HASHFUNCTIONS_H */
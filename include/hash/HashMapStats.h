@@ -0,0 +1,135 @@
+/*
+ * File:   HashMapStats.h
+ *
+ * HashMapStats: counters of a hash map, to tune its hash function and load factor
+ *  + counted while enabled (see xMap::enableStats): operations, probes, collisions,
+ *      rehashes and their time, the load factor at every rehash
+ *  + measured when the stats are taken (xMap::getStats): size, capacity,
+ *      bucket-length histogram, bytes used
+ *  Export with toString() (text) or toJSON().
+ */
+
+#ifndef HASHMAPSTATS_H
+#define HASHMAPSTATS_H
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+/*
+ * LoadSample: the map just before a rehash (or a shrink)
+ */
+struct LoadSample
+{
+    long long operation; // operations (put, lookup, remove) done so far
+    int count;
+    int capacity;
+    int newCapacity;
+};
+
+struct HashMapStats
+{
+    static const int HISTORY = 64;  // load samples kept (the latest ones)
+    static const int MAX_LENGTH = 16; // last histogram bin: buckets of MAX_LENGTH or more entries
+
+    // counted while enabled
+    long long puts = 0;
+    long long lookups = 0; // get, containsKey
+    long long removes = 0;
+    long long probes = 0;   // keys compared, by all the operations above
+    long long maxProbe = 0; // most keys compared by one operation
+    long long collisions = 0; // new keys put into a non-empty bucket
+    long long rehashes = 0;
+    double rehashMillis = 0;  // incremental rehash: the sum of all its steps
+    vector<LoadSample> loadHistory;
+
+    // measured by getStats
+    int count = 0;
+    int capacity = 0;
+    vector<long long> bucketHistogram; // [i]: buckets holding i entries
+    long long bytes = 0;               // table and entries (not what keys or values point to)
+
+    long long operations() const
+    {
+        return puts + lookups + removes;
+    }
+    double meanProbe() const
+    {
+        return operations() == 0 ? 0 : (double)probes / operations();
+    }
+    double loadFactor() const
+    {
+        return capacity == 0 ? 0 : (double)count / capacity;
+    }
+
+    void recordProbe(long long n)
+    {
+        probes += n;
+        maxProbe = max(maxProbe, n);
+    }
+    void recordRehash(int count, int capacity, int newCapacity)
+    {
+        rehashes++;
+        if ((int)loadHistory.size() == HISTORY)
+            loadHistory.erase(loadHistory.begin());
+        loadHistory.push_back(LoadSample{operations(), count, capacity, newCapacity});
+    }
+    void clearCounters()
+    {
+        puts = lookups = removes = probes = maxProbe = collisions = rehashes = 0;
+        rehashMillis = 0;
+        loadHistory.clear();
+    }
+
+    string toString() const
+    {
+        stringstream os;
+        os << fixed << setprecision(3);
+        os << "size: " << count << ", capacity: " << capacity
+           << ", load factor: " << loadFactor() << ", bytes: " << bytes << endl;
+        os << "operations: " << operations() << " (put " << puts << ", lookup " << lookups
+           << ", remove " << removes << ")" << endl;
+        os << "probes: mean " << meanProbe() << ", max " << maxProbe
+           << ", collisions: " << collisions << endl;
+        os << "rehashes: " << rehashes << ", " << rehashMillis << " ms" << endl;
+        os << "bucket lengths:";
+        for (int len = 0; len < (int)bucketHistogram.size(); len++)
+            if (bucketHistogram[len] > 0)
+                os << " " << len << (len == MAX_LENGTH ? "+" : "") << ":" << bucketHistogram[len];
+        os << endl;
+        os << "load at rehash:";
+        for (const LoadSample &sample : loadHistory)
+            os << " " << (double)sample.count / sample.capacity << "@" << sample.operation;
+        os << endl;
+        return os.str();
+    }
+
+    string toJSON() const
+    {
+        stringstream os;
+        os << "{\"count\": " << count << ", \"capacity\": " << capacity
+           << ", \"loadFactor\": " << loadFactor() << ", \"bytes\": " << bytes
+           << ", \"puts\": " << puts << ", \"lookups\": " << lookups << ", \"removes\": " << removes
+           << ", \"probes\": " << probes << ", \"meanProbe\": " << meanProbe()
+           << ", \"maxProbe\": " << maxProbe << ", \"collisions\": " << collisions
+           << ", \"rehashes\": " << rehashes << ", \"rehashMillis\": " << rehashMillis
+           << ", \"bucketHistogram\": [";
+        for (int len = 0; len < (int)bucketHistogram.size(); len++)
+            os << (len > 0 ? ", " : "") << bucketHistogram[len];
+        os << "], \"loadHistory\": [";
+        for (int idx = 0; idx < (int)loadHistory.size(); idx++)
+        {
+            const LoadSample &sample = loadHistory[idx];
+            os << (idx > 0 ? ", " : "") << "{\"operation\": " << sample.operation
+               << ", \"count\": " << sample.count << ", \"capacity\": " << sample.capacity
+               << ", \"newCapacity\": " << sample.newCapacity << "}";
+        }
+        os << "]}";
+        return os.str();
+    }
+};
+
+#endif /* HASHMAPSTATS_H */
@@ -55,6 +55,9 @@ class IMap {
 public:
     virtual ~IMap(){};
     //
+    // keys and values are passed by const reference: a lookup copies nothing,
+    // put copies key and value once, into the map
+    //
     /*
     put(K key, V value): 
     if key is not in the map: 
@@ -64,7 +67,7 @@ public:
         + associate key with the new value (passed as parameter) 
         + return the old value
     */
-    virtual V put(K key, V value)=0;
+    virtual V put(const K& key, const V& value)=0;
     
     /*
     get(K key):
@@ -72,7 +75,7 @@ public:
      else: KeyNotFound exception thrown
 
     */
-    virtual V& get(K key)=0;
+    virtual V& get(const K& key)=0;
     
     /*
     remove(K key):
@@ -81,7 +84,7 @@ public:
     
     >> deleteKeyInMap(K key): delete key stored in map; in cases, K is a pointer type
     */
-    virtual V remove(K key, void (*deleteKeyInMap)(K)=0)=0;
+    virtual V remove(const K& key, void (*deleteKeyInMap)(K)=0)=0;
     
     /*
     remove(K key, V value):
@@ -91,21 +94,21 @@ public:
     >> deleteKeyInMap(K key): delete key stored in map; in cases, K is a pointer type
     >> deleteValueInMap(V value): delete key stored in map; in cases, V is a pointer type
     */
-    virtual bool remove(K key, V value, void (*deleteKeyInMap)(K)=0, void (*deleteValueInMap)(V)=0)=0;
+    virtual bool remove(const K& key, const V& value, void (*deleteKeyInMap)(K)=0, void (*deleteValueInMap)(V)=0)=0;
     
     /*
     containsKey(K key):
     if key is in the map: return true
     else: return false
     */
-    virtual bool containsKey(K key)=0;
+    virtual bool containsKey(const K& key)=0;
     
     /*
     containsKey(V value):
     if value is in the map: return true
     else: return false
     */
-    virtual bool containsValue(V value)=0;
+    virtual bool containsValue(const V& value)=0;
     
     /*
     empty():
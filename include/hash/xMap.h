@@ -17,10 +17,17 @@
 #include <string>
 #include <sstream>
 #include <memory.h>
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <chrono>
 using namespace std;
 
 #include "list/DLinkedList.h"
+#include "list/IntrusiveList.h"
 #include "hash/IMap.h"
+#include "hash/HashFunctions.h"
+#include "hash/HashMapStats.h"
 
 /*
  * xMap<K, V>:
@@ -33,15 +40,32 @@ template <class K, class V>
 class xMap : public IMap<K, V>
 {
 public:
-  class Entry; // forward declaration
+  class Entry;         // forward declaration
+  class Iterator;      // forward declaration
+  class ConstIterator; // forward declaration
 
 protected:
-  DLinkedList<Entry *> *table; // array of DLinkedList objects
+  static const int HASH_RANGE = 0x7FFFFFFF; // tableSize passed to hashCode to get a full hash
+  static const int REHASH_PREFETCH = 32;     // moveEntries: buckets to look ahead
+  static const int BUILD_PER_STEP = 16;      // incremental rehash: new buckets constructed per step
+
+  IntrusiveList<Entry> *table; // array of buckets, entries are linked through their own hook
   int capacity;                // size of table
   int count;                   // number of entries stored hash-map
   float loadFactor;            // define max number of entries can be stored (< (loadFactor * capacity))
-  DLinkedList<int> list_clashes;
+  bool powerOfTwo;             // power-of-two capacity, index = hash & (capacity - 1); see setPowerOfTwo
+  int rehashStep;              // incremental rehash: old buckets moved per operation, 0: all at once
+  float shrinkLoad;            // remove() shrinks the table when count < shrinkLoad * capacity, 0: never
+
+  // incremental rehash in progress (oldTable != 0):
+  //  table[0 .. built) are constructed; oldTable[0 .. migrated) are moved to table and destroyed
+  IntrusiveList<Entry> *oldTable;
+  int oldCapacity;
+  int migrated;
+  int built;
+  HashMapStats *stats;         // 0: not collected, see enableStats
   int (*hashCode)(K &, int);          // hasCode(K key, int tableSize): tableSize means capacity
+  typename KeyView<K>::Hash viewHashCode; // hashCode for key views, 0: views are converted to K
   bool (*keyEqual)(K &, K &);         // keyEqual(K& lhs, K& rhs): test if lhs == rhs
   bool (*valueEqual)(V &, V &);       // valueEqual(V& lhs, V& rhs): test if lhs == rhs
   void (*deleteKeys)(xMap<K, V> *);   // deleteKeys(xMap<K,V>* pMap): delete all keys stored in pMap
@@ -61,12 +85,12 @@ public:
   ~xMap();
 
   // Inherit from IMap:BEGIN
-  V put(K key, V value);
-  V &get(K key);
-  V remove(K key, void (*deleteKeyInMap)(K) = 0);
-  bool remove(K key, V value, void (*deleteKeyInMap)(K) = 0, void (*deleteValueInMap)(V) = 0);
-  bool containsKey(K key);
-  bool containsValue(V value);
+  V put(const K &key, const V &value);
+  V &get(const K &key);
+  V remove(const K &key, void (*deleteKeyInMap)(K) = 0);
+  bool remove(const K &key, const V &value, void (*deleteKeyInMap)(K) = 0, void (*deleteValueInMap)(V) = 0);
+  bool containsKey(const K &key);
+  bool containsValue(const V &value);
   bool empty();
   int size();
   void clear();
@@ -76,6 +100,84 @@ public:
   DLinkedList<int> clashes();
   // Inherit from IMap:END
 
+  /*
+   * Lookups by key view: anything convertible to KeyView<K>::type (hash/HashFunctions.h),
+   *  e.g. a const char* or a string_view when K is string, is looked up as is:
+   *
+   *    xMap<string, int> map(&xMap<string, int>::stringKeyHash);
+   *    map.get("FC_1_W");   // no temporary string
+   *
+   *  The view is hashed with the view version of hashCode: found by KeyView for the
+   *  hooks of hash/HashFunctions.h and stringKeyHash, or given with setViewHash.
+   *  Without one (or with a keyEqual hook) a temporary K is built as before.
+   */
+  template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type = 0>
+  V &get(const Q &key);
+  template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type = 0>
+  bool containsKey(const Q &key);
+  template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type = 0>
+  V remove(const Q &key, void (*deleteKeyInMap)(K) = 0);
+  /*
+   * find(key): pointer to the value of key, 0 if absent; one lookup where
+   *  containsKey(key) followed by get(key) takes two (key or key view)
+   */
+  V *find(const K &key);
+  template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type = 0>
+  V *find(const Q &key);
+  /*
+   * setViewHash(viewHashCode): hash of a key view, equal to hashCode(key, tableSize)
+   *  for the key K(view); needed when hashCode is not one of the known hooks
+   */
+  void setViewHash(typename KeyView<K>::Hash viewHashCode)
+  {
+    this->viewHashCode = viewHashCode;
+  }
+
+  /*
+   * Iteration without copies: begin/end visit every entry in place, in bucket order
+   *  (no list is built, no key is hashed again); an iterator stays valid until the
+   *  map is modified. Example, with "map" of type xMap<string, int>:
+   *
+   *    for (auto &entry : map)
+   *      cout << entry.getKey() << " -> " << entry.getValue() << endl;
+   *
+   *    map.forEach([](const string &key, int &value) { value++; });
+   *
+   *  A const xMap (e.g., "const xMap<K, V>& view") gives ConstIterator and a const forEach:
+   *  the values are read-only too.
+   */
+  Iterator begin()
+  {
+    return Iterator(this, true);
+  }
+  Iterator end()
+  {
+    return Iterator(this, false);
+  }
+  ConstIterator begin() const
+  {
+    return ConstIterator(Iterator(const_cast<xMap<K, V> *>(this), true));
+  }
+  ConstIterator end() const
+  {
+    return ConstIterator(Iterator(const_cast<xMap<K, V> *>(this), false));
+  }
+  /*
+   * forEach(fn): call fn(key, value) on every entry, value by reference
+   */
+  template <class Function>
+  void forEach(Function fn)
+  {
+    for (Iterator it = begin(); it != end(); ++it)
+      fn((const K &)(*it).key, (*it).value);
+  }
+  template <class Function>
+  void forEach(Function fn) const
+  {
+    for (ConstIterator it = begin(); it != end(); ++it)
+      fn((*it).key, (*it).value);
+  }
+
   // Show map on screen: need to convert key to string (key2str) and value2str
   void println(string (*key2str)(K &) = 0, string (*value2str)(V &) = 0)
   {
@@ -85,6 +187,68 @@ public:
   {
     return capacity;
   }
+  /*
+   * setPowerOfTwo(enable):
+   *  + false (default): capacity grows by 1.5 from 10, index = hashCode(key, capacity);
+   *      a rehash calls hashCode again for every key
+   *  + true: capacity is a power of two and doubles, every entry caches its full hash
+   *      (hashCode(key, HASH_RANGE), mixed) and index = hash & (capacity - 1);
+   *      a rehash never calls hashCode, lookups compare the cached hash before the key
+   *  Can be changed at any time; the entries are rehashed.
+   */
+  void setPowerOfTwo(bool enable);
+  bool isPowerOfTwo()
+  {
+    return powerOfTwo;
+  }
+  /*
+   * setIncrementalRehash(step):
+   *  + 0 (default): put() rehashes the whole table when the load factor is exceeded
+   *  + step > 0: the new table is built and filled a little at a time; until it is done,
+   *      both tables are live and each put/get/remove/containsKey first constructs
+   *      step * BUILD_PER_STEP new buckets, then moves "step" non-empty old buckets
+   *      (a key is in the old table if its old bucket has not been moved yet)
+   *  Operations on the whole map (keys, values, toString, copy, ...) finish the rehash first.
+   */
+  void setIncrementalRehash(int step = 4);
+  /*
+   * Capacity management:
+   *  + reserve(n): grow the table once so that n keys fit without any rehash
+   *      (e.g., before a bulk load of a known number of keys)
+   *  + shrink_to_fit(): the smallest table that holds the current keys
+   *  + setShrinkLoad(minLoad): after a remove, if count < minLoad * capacity, the table
+   *      is shrunk to hold 2 * count keys (load factor about loadFactor / 2);
+   *      minLoad is capped at loadFactor / 4, so that neither a few puts nor a few
+   *      removes after a shrink resize the table again (hysteresis). 0 (default): never
+   *  The table never shrinks below the initial capacity (10, or 16 with setPowerOfTwo).
+   */
+  void reserve(int n);
+  void shrink_to_fit();
+  void setShrinkLoad(float minLoad = 0.1f)
+  {
+    this->shrinkLoad = max(0.0f, min(minLoad, loadFactor / 4));
+  }
+  /*
+   * Statistics (see hash/HashMapStats.h), off by default:
+   *  + enableStats(enable): start (from zero) or stop counting; when on, each operation
+   *      costs a few increments, a rehash two clock reads
+   *  + getStats(): the counters, with the bucket-length histogram, size and bytes
+   *      measured now (one pass over the buckets)
+   *  + resetStats(): counters back to zero
+   *  For example: cout << map.getStats().toJSON() << endl;
+   *  A copy of the map starts with the stats off.
+   */
+  void enableStats(bool enable = true);
+  HashMapStats getStats();
+  void resetStats()
+  {
+    if (stats != 0)
+      stats->clearCounters();
+  }
+  bool isRehashing()
+  {
+    return oldTable != 0;
+  }
 
   ///////////////////////////////////////////////////
   // STATIC METHODS: BEGIN
@@ -92,17 +256,31 @@ public:
   ///////////////////////////////////////////////////
   /*
    * sample hash function for keys of types integer and string:
+   *  (see hash/HashFunctions.h for other choices, e.g. the former
+   *  "key % capacity" and "sum of characters" are moduloIntHash and sumStringHash)
    */
   static int intKeyHash(int &key, int capacity)
   {
-    return key % capacity;
+    return mixIntHash(key, capacity);
   }
   static int stringKeyHash(string &key, int capacity)
   {
-    long long int sum = 0;
-    for (int idx = 0; idx < key.length(); idx++)
-      sum += key[idx];
-    return sum % capacity;
+    return wyStringHash(key, capacity);
+  }
+  /*
+   * viewHashOf(hashCode): the view version of hashCode (see KeyView), 0 if unknown;
+   *  the string overload also knows stringKeyHash, a wyStringHash under another address
+   */
+  template <class KK>
+  static typename KeyView<KK>::Hash viewHashOf(int (*hashCode)(KK &, int))
+  {
+    return KeyView<KK>::viewHash(hashCode);
+  }
+  static typename KeyView<string>::Hash viewHashOf(int (*hashCode)(string &, int))
+  {
+    if (hashCode == &stringKeyHash)
+      return &wyViewHash;
+    return KeyView<string>::viewHash(hashCode);
   }
   /*
    * freeKey(xMap<K,V> *pMap):
@@ -115,7 +293,7 @@ public:
   {
     for (int idx = 0; idx < pMap->capacity; idx++)
     {
-      DLinkedList<Entry *> list = pMap->table[idx];
+      IntrusiveList<Entry> &list = pMap->table[idx];
       for (auto pEntry : list)
       {
         delete pEntry->key;
@@ -133,7 +311,7 @@ public:
   {
     for (int idx = 0; idx < pMap->capacity; idx++)
     {
-      DLinkedList<Entry *> list = pMap->table[idx];
+      IntrusiveList<Entry> &list = pMap->table[idx];
       for (auto pEntry : list)
       {
         delete pEntry->value;
@@ -157,32 +335,79 @@ protected:
   ////////////////////////  UTILITIES ////////////////////
   ////////////////////////////////////////////////////////
   void ensureLoadFactor(int minCapacity);
-  // future version:
-  //   should add a method to trim table shorter when removing key (and value)
+  void shrinkIfSparse();
+  int capacityFor(int n);
   void rehash(int newCapacity);
+  void rehashAll(int newCapacity);
+  void rehashSome(int steps);
+  void finishRehash();
+  static IntrusiveList<Entry> *newTable(int capacity);
+  static void deleteTable(IntrusiveList<Entry> *table, int capacity);
+  void copyTableFrom(const xMap<K, V> &map);
   void removeInternalData();
   void copyMapFrom(const xMap<K, V> &map);
   void moveEntries(
-      DLinkedList<Entry *> *oldTable, int oldCapacity,
-      DLinkedList<Entry *> *newTable, int newCapacity);
+      IntrusiveList<Entry> *oldTable, int oldCapacity,
+      IntrusiveList<Entry> *newTable, int newCapacity);
+
+  /*
+   * hashOf(key): the hash cached in the entry of key (0 if powerOfTwo is off)
+   * indexOf(key, hash, tableSize): bucket of key in a table of tableSize buckets
+   * bucketOf(key, hash): the bucket that holds (or will hold) key, in oldTable while
+   *    an incremental rehash has not moved it yet
+   * match(entry, key, hash): entry holds key; the cached hash is compared first
+   *  (the hooks take K&, but never change the key: it is passed through const_cast)
+   */
+  uint32_t hashOf(const K &key)
+  {
+    if (!powerOfTwo)
+      return 0;
+    return hashMix32((uint32_t)hashCode(const_cast<K &>(key), HASH_RANGE));
+  }
+  int indexOf(const K &key, uint32_t hash, int tableSize)
+  {
+    if (powerOfTwo)
+      return (int)(hash & (uint32_t)(tableSize - 1));
+    return hashCode(const_cast<K &>(key), tableSize);
+  }
+  IntrusiveList<Entry> &bucketOf(const K &key, uint32_t hash)
+  {
+    if (oldTable != 0)
+    {
+      int oldIndex = indexOf(key, hash, oldCapacity);
+      if (oldIndex >= migrated)
+        return oldTable[oldIndex];
+    }
+    return table[indexOf(key, hash, capacity)];
+  }
+  bool match(Entry *entry, const K &key, uint32_t hash)
+  {
+    return entry->hash == hash && keyEQ(entry->key, key);
+  }
+  /*
+   * find(key, hash, pBucket): the entry of key and its bucket, 0 if not found
+   * findView(key, pBucket): the same for a key view
+   */
+  Entry *find(const K &key, uint32_t hash, IntrusiveList<Entry> *&pBucket);
+  Entry *findView(typename KeyView<K>::type key, IntrusiveList<Entry> *&pBucket);
 
   /*
    * keyEQ(K& lhs, K& rhs): verify the equality of two keys
    */
-  bool keyEQ(K &lhs, K &rhs)
+  bool keyEQ(const K &lhs, const K &rhs)
   {
     if (keyEqual != 0)
-      return keyEqual(lhs, rhs);
+      return keyEqual(const_cast<K &>(lhs), const_cast<K &>(rhs));
     else
       return lhs == rhs;
   }
   /*
    *  valueEQ(V& lhs, V& rhs): verify the equality of two values
    */
-  bool valueEQ(V &lhs, V &rhs)
+  bool valueEQ(const V &lhs, const V &rhs)
   {
     if (valueEqual != 0)
-      return valueEqual(lhs, rhs);
+      return valueEqual(const_cast<V &>(lhs), const_cast<V &>(rhs));
     else
       return lhs == rhs;
   }
@@ -192,21 +417,157 @@ protected:
   //////////////////////////////////////////////////////////////////////
 public:
   // Entry: BEGIN
-  class Entry
+  class Entry : public IntrusiveListHook<>
   {
   private:
     K key;
     V value;
+    uint32_t hash; // full hash of key when the map uses power-of-two capacity, 0 otherwise
     friend class xMap<K, V>;
 
   public:
-    Entry(K key, V value)
+    Entry(const K &key, const V &value, uint32_t hash = 0)
     {
       this->key = key;
       this->value = value;
+      this->hash = hash;
+    }
+    // the key must not be changed in place: it decides the bucket of the entry
+    const K &getKey() const
+    {
+      return key;
+    }
+    V &getValue()
+    {
+      return value;
+    }
+    const V &getValue() const
+    {
+      return value;
     }
   };
   // Entry: END
+
+  /*
+   * Iterator: walks the buckets of table, then (during an incremental rehash)
+   *  the buckets of oldTable that are not moved yet; phase 2 is end()
+   */
+  class Iterator
+  {
+  private:
+    xMap<K, V> *pMap;
+    int phase;
+    int bucket;
+    typename IntrusiveList<Entry>::Iterator pos;
+    friend class xMap<K, V>;
+
+    IntrusiveList<Entry> *list()
+    {
+      return phase == 0 ? &pMap->table[bucket] : &pMap->oldTable[bucket];
+    }
+    // first non-empty bucket at or after "bucket" (in this phase or the next ones)
+    void seek()
+    {
+      while (phase < 2)
+      {
+        int last = phase == 0 ? (pMap->oldTable != 0 ? pMap->built : pMap->capacity)
+                              : (pMap->oldTable != 0 ? pMap->oldCapacity : 0);
+        for (; bucket < last; bucket++)
+          if (!list()->empty())
+          {
+            pos = list()->begin();
+            return;
+          }
+        phase++;
+        bucket = pMap->oldTable != 0 ? pMap->migrated : 0;
+      }
+      bucket = 0;
+      pos = typename IntrusiveList<Entry>::Iterator();
+    }
+
+  public:
+    Iterator(xMap<K, V> *pMap = 0, bool begin = true) : pMap(pMap), phase(2), bucket(0)
+    {
+      if (pMap != 0 && begin)
+      {
+        phase = 0;
+        seek();
+      }
+    }
+    Entry &operator*()
+    {
+      return **pos;
+    }
+    Entry *operator->()
+    {
+      return *pos;
+    }
+    bool operator!=(const Iterator &iterator)
+    {
+      return phase != iterator.phase || bucket != iterator.bucket || pos != iterator.pos;
+    }
+    bool operator==(const Iterator &iterator)
+    {
+      return !(*this != iterator);
+    }
+    // Prefix ++ overload
+    Iterator &operator++()
+    {
+      ++pos;
+      if (!(pos != list()->end()))
+      {
+        bucket++;
+        seek();
+      }
+      return *this;
+    }
+    // Postfix ++ overload
+    Iterator operator++(int)
+    {
+      Iterator iterator = *this;
+      ++*this;
+      return iterator;
+    }
+  };
+
+  /*
+   * ConstIterator: Iterator over a const xMap, entries are read-only
+   */
+  class ConstIterator
+  {
+  private:
+    Iterator it;
+
+  public:
+    ConstIterator(Iterator it = Iterator()) : it(it) {}
+    const Entry &operator*()
+    {
+      return *it;
+    }
+    const Entry *operator->()
+    {
+      return &*it;
+    }
+    bool operator!=(const ConstIterator &iterator)
+    {
+      return it != iterator.it;
+    }
+    bool operator==(const ConstIterator &iterator)
+    {
+      return it == iterator.it;
+    }
+    ConstIterator &operator++()
+    {
+      ++it;
+      return *this;
+    }
+    ConstIterator operator++(int)
+    {
+      ConstIterator iterator = *this;
+      ++it;
+      return iterator;
+    }
+  };
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -224,6 +585,7 @@ xMap<K, V>::xMap(
 {
   // Khởi tạo các tham số truyền vào
   this->hashCode = hashCode;
+  this->viewHashCode = viewHashOf(hashCode);
   this->loadFactor = loadFactor;
   this->valueEqual = valueEqual;
   this->deleteValues = deleteValues;
@@ -233,7 +595,12 @@ xMap<K, V>::xMap(
   // Cấp phát và khởi tạo bảng băm
   this->capacity = 10;
   this->count = 0;
-  this->table = new DLinkedList<Entry *>[this->capacity];
+  this->powerOfTwo = false;
+  this->rehashStep = 0;
+  this->shrinkLoad = 0;
+  this->stats = 0;
+  this->oldTable = 0;
+  this->table = newTable(this->capacity);
 }
 
 template <class K, class V>
@@ -243,32 +610,23 @@ xMap<K, V>::xMap(const xMap<K, V> &map)
   this->capacity = map.capacity;
   this->count = map.count;
   this->loadFactor = map.loadFactor;
+  this->powerOfTwo = map.powerOfTwo;
+  this->rehashStep = map.rehashStep;
+  this->shrinkLoad = map.shrinkLoad;
 
   // Sao chép các hàm callback
   this->hashCode = map.hashCode;
+  this->viewHashCode = map.viewHashCode;
   this->keyEqual = map.keyEqual;
   this->valueEqual = map.valueEqual;
   // this->deleteKeys = map.deleteKeys;
   //  this->deleteValues = map.deleteValues;
   this->deleteKeys = nullptr;
   this->deleteValues = nullptr;
+  this->stats = 0;
 
   // Tạo một bản sao của bảng băm
-  this->table = new DLinkedList<Entry *>[this->capacity];
-
-  // Sao chép từng phần tử từ bảng băm của `map`
-  for (int i = 0; i < this->capacity; i++)
-  {
-    DLinkedList<Entry *> &srcList = map.table[i];
-    DLinkedList<Entry *> &destList = this->table[i];
-
-    for (auto srcEntry : srcList)
-    {
-      // Tạo một bản sao của từng `Entry` trong danh sách liên kết
-      Entry *newEntry = new Entry(srcEntry->key, srcEntry->value);
-      destList.add(newEntry);
-    }
-  }
+  this->copyTableFrom(map);
 }
 
 template <class K, class V>
@@ -287,30 +645,20 @@ xMap<K, V> &xMap<K, V>::operator=(const xMap<K, V> &map)
   this->capacity = map.capacity;
   this->count = map.count;
   this->loadFactor = map.loadFactor;
+  this->powerOfTwo = map.powerOfTwo;
+  this->rehashStep = map.rehashStep;
+  this->shrinkLoad = map.shrinkLoad;
 
   // Sao chép các hàm callback
   this->hashCode = map.hashCode;
+  this->viewHashCode = map.viewHashCode;
   this->keyEqual = map.keyEqual;
   this->valueEqual = map.valueEqual;
   this->deleteKeys = nullptr;
   this->deleteValues = nullptr;
 
   // Tạo bảng băm mới
-  this->table = new DLinkedList<Entry *>[this->capacity];
-
-  // Sao chép các phần tử từ `map`
-  for (int i = 0; i < this->capacity; i++)
-  {
-    DLinkedList<Entry *> &srcList = map.table[i];
-    DLinkedList<Entry *> &destList = this->table[i];
-
-    for (auto srcEntry : srcList)
-    {
-      // Tạo bản sao của từng `Entry` và thêm vào danh sách liên kết
-      Entry *newEntry = new Entry(srcEntry->key, srcEntry->value);
-      destList.add(newEntry);
-    }
-  }
+  this->copyTableFrom(map);
 
   return *this; // Trả về đối tượng hiện tại
 }
@@ -320,6 +668,7 @@ xMap<K, V>::~xMap()
 {
   // Giải phóng tài nguyên nội bộ
   this->removeInternalData();
+  delete this->stats;
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -327,37 +676,37 @@ xMap<K, V>::~xMap()
 //////////////////////////////////////////////////////////////////////
 
 template <class K, class V>
-V xMap<K, V>::put(K key, V value)
+V xMap<K, V>::put(const K &key, const V &value)
 {
-  // Tính toán chỉ số bucket từ hashCode
-  int index = this->hashCode(key, this->capacity);
+  if (this->oldTable != 0)
+    this->rehashSome(this->rehashStep);
+  if (stats != 0)
+    stats->puts++;
 
-  // Lấy danh sách bucket từ bảng băm
-  DLinkedList<Entry *> &bucket = this->table[index];
+  // Tính toán chỉ số bucket từ hashCode
+  uint32_t hash = this->hashOf(key);
 
-  // Duyệt qua danh sách để tìm key
-  for (auto entry : bucket)
+  // Tìm key trong bucket
+  IntrusiveList<Entry> *bucket;
+  Entry *entry = this->find(key, hash, bucket);
+  if (entry != 0)
   {
-    if (this->keyEQ(entry->key, key)) 
-    {
-      // Key đã tồn tại, cập nhật value
-      V oldValue = entry->value; // Lưu giá trị cũ để trả về
-      entry->value = value;      // Cập nhật giá trị mới
-      return oldValue;
-    }
+    // Key đã tồn tại, cập nhật value
+    V oldValue = entry->value; // Lưu giá trị cũ để trả về
+    entry->value = value;      // Cập nhật giá trị mới
+    return oldValue;
   }
 
   // Nếu key chưa tồn tại, thêm một Entry mới vào bucket
-  Entry *newEntry = new Entry(key, value);
-  bucket.add(newEntry); // Thêm entry mới vào danh sách
+  if (stats != 0 && !bucket->empty())
+    stats->collisions++;
+  Entry *newEntry = new Entry(key, value, hash);
+  bucket->add(newEntry); // Thêm entry mới vào danh sách
 
   // Tăng số lượng phần tử
   this->count++;
 
   // Đảm bảo hệ số tải không vượt quá ngưỡng
-  if (bucket.size() > 1 && !list_clashes.contains(index))
-    list_clashes.add(index);
-
   if (count > capacity * loadFactor)
   {
     ensureLoadFactor(count + 1);
@@ -368,23 +717,20 @@ V xMap<K, V>::put(K key, V value)
 }
 
 template <class K, class V>
-V &xMap<K, V>::get(K key)
+V &xMap<K, V>::get(const K &key)
 {
   // Tính toán chỉ số bucket từ hashCode
-  int index = hashCode(key, capacity);
-
-  // Lấy danh sách bucket tại chỉ số đó
-  DLinkedList<Entry *> &bucket = table[index];
-
-  // Duyệt qua danh sách để tìm key
-  for (auto entry : bucket)
-  {
-    if (keyEQ(entry->key, key))
-    {
-      // Nếu tìm thấy key, trả về value tương ứng
-      return entry->value;
-    }
-  }
+  if (oldTable != 0)
+    rehashSome(rehashStep);
+  if (stats != 0)
+    stats->lookups++;
+  uint32_t hash = hashOf(key);
+
+  // Tìm key trong bucket, trả về value tương ứng
+  IntrusiveList<Entry> *bucket;
+  Entry *entry = find(key, hash, bucket);
+  if (entry != 0)
+    return entry->value;
 
   // Nếu không tìm thấy key, ném ngoại lệ KeyNotFound
   stringstream os;
@@ -393,110 +739,184 @@ V &xMap<K, V>::get(K key)
 }
 
 template <class K, class V>
-V xMap<K, V>::remove(K key, void (*deleteKeyInMap)(K))
+V xMap<K, V>::remove(const K &key, void (*deleteKeyInMap)(K))
 {
   // Tính toán chỉ số bucket từ hashCode
-  int index = hashCode(key, capacity);
-
-  // Lấy danh sách bucket tại chỉ số đó
-  DLinkedList<Entry *> &bucket = table[index];
-
-  // Duyệt qua danh sách để tìm key
-  for (auto it = bucket.begin(); it != bucket.end(); ++it)
+  if (oldTable != 0)
+    rehashSome(rehashStep);
+  if (stats != 0)
+    stats->removes++;
+  uint32_t hash = hashOf(key);
+
+  IntrusiveList<Entry> *bucket;
+  Entry *entry = find(key, hash, bucket);
+  if (entry == 0)
   {
-    if (keyEQ((*it)->key, key))
-    {
-      // Nếu tìm thấy key, sao lưu giá trị
-      V retValue = (*it)->value;
-
-      // Giải phóng bộ nhớ key nếu deleteKeyInMap khác nullptr
-      if (deleteKeyInMap != nullptr)
-      {
-        deleteKeyInMap((*it)->key);
-      }
+    // Nếu không tìm thấy key, ném ngoại lệ KeyNotFound
+    stringstream os;
+    os << "key (" << key << ") is not found";
+    throw KeyNotFound(os.str());
+  }
 
-      // Gỡ Entry khỏi danh sách và giải phóng bộ nhớ của Entry
-      bucket.removeItem(*it);
-      delete *it; // Giải phóng bộ nhớ Entry
+  // Nếu tìm thấy key, sao lưu giá trị
+  V retValue = entry->value;
 
-      // Trả về giá trị đã sao lưu
-      return retValue;
-    }
+  // Giải phóng bộ nhớ key nếu deleteKeyInMap khác nullptr
+  if (deleteKeyInMap != nullptr)
+  {
+    deleteKeyInMap(entry->key);
   }
 
-  // Nếu không tìm thấy key, ném ngoại lệ KeyNotFound
-  stringstream os;
-  os << "key (" << key << ") is not found";
-  throw KeyNotFound(os.str());
+  // Gỡ Entry khỏi danh sách và giải phóng bộ nhớ của Entry
+  bucket->removeItem(entry, &deleteEntry);
+  count--;
+  shrinkIfSparse();
+
+  // Trả về giá trị đã sao lưu
+  return retValue;
 }
 
 template <class K, class V>
-bool xMap<K, V>::remove(K key, V value, void (*deleteKeyInMap)(K), void (*deleteValueInMap)(V))
+bool xMap<K, V>::remove(const K &key, const V &value, void (*deleteKeyInMap)(K), void (*deleteValueInMap)(V))
 {
   // Tính toán chỉ số bucket từ hashCode
-  int index = hashCode(key, capacity);
-
-  // Lấy danh sách bucket tại chỉ số đó
-  DLinkedList<Entry *> &bucket = table[index];
-
-  // Duyệt qua danh sách để tìm cặp <key, value>
-  for (auto it = bucket.begin(); it != bucket.end(); ++it)
+  if (oldTable != 0)
+    rehashSome(rehashStep);
+  if (stats != 0)
+    stats->removes++;
+  uint32_t hash = hashOf(key);
+
+  // Tìm cặp <key, value>: key là duy nhất, nên chỉ cần so sánh value của entry tìm được
+  IntrusiveList<Entry> *bucket;
+  Entry *entry = find(key, hash, bucket);
+  if (entry == 0 || !valueEQ(entry->value, value))
+    return false;
+
+  // Nếu tìm thấy cặp <key, value>, giải phóng bộ nhớ nếu cần
+  if (deleteKeyInMap != nullptr)
   {
-    if (keyEQ((*it)->key, key) && valueEQ((*it)->value, value))
-    {
-      // Nếu tìm thấy cặp <key, value>, giải phóng bộ nhớ nếu cần
-      if (deleteKeyInMap != nullptr)
-      {
-        deleteKeyInMap((*it)->key);
-      }
-      if (deleteValueInMap != nullptr)
-      {
-        deleteValueInMap((*it)->value);
-      }
-
-      // Gỡ Entry khỏi danh sách và giải phóng bộ nhớ của Entry
-      bucket.removeItem(*it);
-      delete *it;
-
-      // Trả về true vì đã xóa thành công
-      return true;
-    }
+    deleteKeyInMap(entry->key);
+  }
+  if (deleteValueInMap != nullptr)
+  {
+    deleteValueInMap(entry->value);
   }
 
-  // Nếu không tìm thấy cặp <key, value>, trả về false
-  return false;
+  // Gỡ Entry khỏi danh sách và giải phóng bộ nhớ của Entry
+  bucket->removeItem(entry, &deleteEntry);
+  count--;
+  shrinkIfSparse();
+
+  // Trả về true vì đã xóa thành công
+  return true;
 }
 
 template <class K, class V>
-bool xMap<K, V>::containsKey(K key)
+bool xMap<K, V>::containsKey(const K &key)
 {
   // Tính toán chỉ số bucket từ hàm băm
-  int index = hashCode(key, capacity);
+  if (oldTable != 0)
+    rehashSome(rehashStep);
+  if (stats != 0)
+    stats->lookups++;
+  uint32_t hash = hashOf(key);
+
+  IntrusiveList<Entry> *bucket;
+  return find(key, hash, bucket) != 0;
+}
 
-  // Lấy danh sách bucket tại chỉ số đó
-  DLinkedList<Entry *> &bucket = table[index];
+template <class K, class V>
+template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type>
+V &xMap<K, V>::get(const Q &key)
+{
+  if (oldTable != 0)
+    rehashSome(rehashStep);
+  if (stats != 0)
+    stats->lookups++;
+  typename KeyView<K>::type view(key);
+  IntrusiveList<Entry> *bucket;
+  Entry *entry = findView(view, bucket);
+  if (entry != 0)
+    return entry->value;
 
-  // Duyệt qua danh sách để kiểm tra sự tồn tại của key
-  for (auto it = bucket.begin(); it != bucket.end(); ++it)
+  stringstream os;
+  os << "key (" << view << ") is not found";
+  throw KeyNotFound(os.str());
+}
+
+template <class K, class V>
+template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type>
+bool xMap<K, V>::containsKey(const Q &key)
+{
+  if (oldTable != 0)
+    rehashSome(rehashStep);
+  if (stats != 0)
+    stats->lookups++;
+  IntrusiveList<Entry> *bucket;
+  return findView(typename KeyView<K>::type(key), bucket) != 0;
+}
+
+template <class K, class V>
+template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type>
+V xMap<K, V>::remove(const Q &key, void (*deleteKeyInMap)(K))
+{
+  if (oldTable != 0)
+    rehashSome(rehashStep);
+  if (stats != 0)
+    stats->removes++;
+  typename KeyView<K>::type view(key);
+  IntrusiveList<Entry> *bucket;
+  Entry *entry = findView(view, bucket);
+  if (entry == 0)
   {
-    if (keyEQ((*it)->key, key))
-    {
-      return true; // Nếu tìm thấy key
-    }
+    stringstream os;
+    os << "key (" << view << ") is not found";
+    throw KeyNotFound(os.str());
   }
 
-  // Không tìm thấy key
-  return false;
+  V retValue = entry->value;
+  if (deleteKeyInMap != nullptr)
+    deleteKeyInMap(entry->key);
+  bucket->removeItem(entry, &deleteEntry);
+  count--;
+  shrinkIfSparse();
+  return retValue;
+}
+
+template <class K, class V>
+V *xMap<K, V>::find(const K &key)
+{
+  if (oldTable != 0)
+    rehashSome(rehashStep);
+  if (stats != 0)
+    stats->lookups++;
+  IntrusiveList<Entry> *bucket;
+  Entry *entry = find(key, hashOf(key), bucket);
+  return entry != 0 ? &entry->value : 0;
 }
 
 template <class K, class V>
-bool xMap<K, V>::containsValue(V value)
+template <class Q, typename enable_if<IsKeyView<Q, K>::value, int>::type>
+V *xMap<K, V>::find(const Q &key)
 {
+  if (oldTable != 0)
+    rehashSome(rehashStep);
+  if (stats != 0)
+    stats->lookups++;
+  IntrusiveList<Entry> *bucket;
+  Entry *entry = findView(typename KeyView<K>::type(key), bucket);
+  return entry != 0 ? &entry->value : 0;
+}
+
+template <class K, class V>
+bool xMap<K, V>::containsValue(const V &value)
+{
+  finishRehash();
   // Duyệt qua tất cả các bucket trong bảng băm
   for (int i = 0; i < capacity; ++i)
   {
     // Lấy danh sách liên kết (bucket) tại vị trí i
-    DLinkedList<Entry *> &bucket = table[i];
+    IntrusiveList<Entry> &bucket = table[i];
 
     // Duyệt qua từng Entry trong bucket
     for (auto it = bucket.begin(); it != bucket.end(); ++it)
@@ -533,16 +953,17 @@ void xMap<K, V>::clear()
   removeInternalData();
 
   // Đặt lại trạng thái ban đầu
-  capacity = 10;
+  capacity = powerOfTwo ? 16 : 10;
   count = 0;
 
   // Khởi tạo lại bảng băm với capacity mới
-  table = new DLinkedList<Entry *>[capacity];
+  table = newTable(capacity);
 }
 
 template <class K, class V>
 DLinkedList<K> xMap<K, V>::keys()
 {
+  finishRehash();
   // Khởi tạo danh sách để chứa các khóa
   DLinkedList<K> keyList;
 
@@ -550,7 +971,7 @@ DLinkedList<K> xMap<K, V>::keys()
   for (int i = 0; i < capacity; i++)
   {
     // Lấy danh sách tại vị trí i
-    DLinkedList<Entry *> *bucket = table + i;
+    IntrusiveList<Entry> *bucket = table + i;
 
     // Duyệt qua các phần tử trong danh sách
     for (Entry *entry : *bucket)
@@ -566,6 +987,7 @@ DLinkedList<K> xMap<K, V>::keys()
 template <class K, class V>
 DLinkedList<V> xMap<K, V>::values()
 {
+  finishRehash();
   // Khởi tạo danh sách để chứa các giá trị
   DLinkedList<V> valueList;
 
@@ -573,7 +995,7 @@ DLinkedList<V> xMap<K, V>::values()
   for (int i = 0; i < capacity; i++)
   {
     // Lấy danh sách tại vị trí i
-    DLinkedList<Entry *> *bucket = table + i;
+    IntrusiveList<Entry> *bucket = table + i;
 
     // Duyệt qua các phần tử trong danh sách
     for (Entry *entry : *bucket)
@@ -589,6 +1011,7 @@ DLinkedList<V> xMap<K, V>::values()
 template <class K, class V>
 DLinkedList<int> xMap<K, V>::clashes()
 {
+  finishRehash();
   // Khởi tạo danh sách kết quả
   DLinkedList<int> clashList;
 
@@ -596,7 +1019,7 @@ DLinkedList<int> xMap<K, V>::clashes()
   for (int i = 0; i < capacity; i++)
   {
     // Lấy danh sách tại chỉ mục i
-    DLinkedList<Entry *> *bucket = table + i;
+    IntrusiveList<Entry> *bucket = table + i;
 
     // Thêm số lượng phần tử trong danh sách vào clashList
     clashList.add(bucket->size());
@@ -608,6 +1031,7 @@ DLinkedList<int> xMap<K, V>::clashes()
 template <class K, class V>
 string xMap<K, V>::toString(string (*key2str)(K &), string (*value2str)(V &))
 {
+  finishRehash();
   stringstream os;
   string mark(50, '=');
   os << mark << endl;
@@ -615,7 +1039,7 @@ string xMap<K, V>::toString(string (*key2str)(K &), string (*value2str)(V &))
   os << setw(12) << left << "size: " << count << endl;
   for (int idx = 0; idx < capacity; idx++)
   {
-    DLinkedList<Entry *> list = table[idx];
+    IntrusiveList<Entry> &list = table[idx];
 
     os << setw(4) << left << idx << ": ";
     stringstream itemos;
@@ -656,21 +1080,92 @@ string xMap<K, V>::toString(string (*key2str)(K &), string (*value2str)(V &))
  */
 template <class K, class V>
 void xMap<K, V>::moveEntries(
-    DLinkedList<Entry *> *oldTable, int oldCapacity,
-    DLinkedList<Entry *> *newTable, int newCapacity)
+    IntrusiveList<Entry> *oldTable, int oldCapacity,
+    IntrusiveList<Entry> *newTable, int newCapacity)
 {
   for (int old_index = 0; old_index < oldCapacity; old_index++)
   {
-    DLinkedList<Entry *> &oldList = oldTable[old_index];
-    for (auto oldEntry : oldList)
+    IntrusiveList<Entry> &oldList = oldTable[old_index];
+    // entries are scattered in memory: start loading the ones of a bucket further ahead
+    int ahead = old_index + REHASH_PREFETCH;
+    if (ahead < oldCapacity && !oldTable[ahead].empty())
+      __builtin_prefetch(oldTable[ahead].front(), 1);
+    while (!oldList.empty())
     {
-      int new_index = this->hashCode(oldEntry->key, newCapacity);
-      DLinkedList<Entry *> &newList = newTable[new_index];
+      // unlink first: an entry has one hook, so it can only be in one bucket
+      Entry *oldEntry = oldList.removeAt(0);
+      int new_index = this->indexOf(oldEntry->key, oldEntry->hash, newCapacity);
+      IntrusiveList<Entry> &newList = newTable[new_index];
       newList.add(oldEntry);
     }
   }
 }
 
+/*
+ * findView:
+ *  Purpose: look up a key view without converting it to K, see get(const Q&)
+ */
+template <class K, class V>
+typename xMap<K, V>::Entry *xMap<K, V>::findView(typename KeyView<K>::type key, IntrusiveList<Entry> *&pBucket)
+{
+  if (viewHashCode == 0 || keyEqual != 0)
+  {
+    // no view hash, or equality decided by a hook on K: a temporary K is needed
+    K tmp(key);
+    return find(tmp, hashOf(tmp), pBucket);
+  }
+
+  uint32_t hash = powerOfTwo ? hashMix32((uint32_t)viewHashCode(key, HASH_RANGE)) : 0;
+  pBucket = 0;
+  if (oldTable != 0)
+  {
+    int oldIndex = powerOfTwo ? (int)(hash & (uint32_t)(oldCapacity - 1)) : viewHashCode(key, oldCapacity);
+    if (oldIndex >= migrated)
+      pBucket = &oldTable[oldIndex];
+  }
+  if (pBucket == 0)
+    pBucket = &table[powerOfTwo ? (int)(hash & (uint32_t)(capacity - 1)) : viewHashCode(key, capacity)];
+  long long probes = 0;
+  Entry *found = 0;
+  for (auto entry : *pBucket)
+  {
+    probes++;
+    if (entry->hash == hash && entry->key == key)
+    {
+      found = entry;
+      break;
+    }
+  }
+  if (stats != 0)
+    stats->recordProbe(probes);
+  return found;
+}
+
+/*
+ * find:
+ *  Purpose: the entry of key (0 if not found) and the bucket it is (or would be) in;
+ *      the keys compared are counted as probes when the stats are enabled
+ */
+template <class K, class V>
+typename xMap<K, V>::Entry *xMap<K, V>::find(const K &key, uint32_t hash, IntrusiveList<Entry> *&pBucket)
+{
+  pBucket = &bucketOf(key, hash);
+  long long probes = 0;
+  Entry *found = 0;
+  for (auto entry : *pBucket)
+  {
+    probes++;
+    if (match(entry, key, hash))
+    {
+      found = entry;
+      break;
+    }
+  }
+  if (stats != 0)
+    stats->recordProbe(probes);
+  return found;
+}
+
 /*
  * ensureLoadFactor:
  *  Purpose: ensure the load-factor,
@@ -686,11 +1181,62 @@ void xMap<K, V>::ensureLoadFactor(int current_size)
   {
     int oldCapacity = capacity;
     // int newCapacity = oldCapacity + (oldCapacity >> 1);
-    int newCapacity = 1.5 * oldCapacity;
+    int newCapacity = powerOfTwo ? 2 * oldCapacity : 1.5 * oldCapacity;
     rehash(newCapacity);
   }
 }
 
+/*
+ * shrinkIfSparse: auto-shrink after a remove, see setShrinkLoad
+ *  (not while an incremental rehash is in progress: it decides again after)
+ */
+template <class K, class V>
+void xMap<K, V>::shrinkIfSparse()
+{
+  if (shrinkLoad == 0 || oldTable != 0 || count >= capacity * shrinkLoad)
+    return;
+  int newCapacity = capacityFor(2 * count);
+  if (newCapacity < capacity)
+    rehash(newCapacity);
+}
+
+/*
+ * capacityFor(n): the smallest capacity that holds n keys within the load factor
+ *  (a power of two if powerOfTwo), at least the initial capacity
+ */
+template <class K, class V>
+int xMap<K, V>::capacityFor(int n)
+{
+  int minCapacity = powerOfTwo ? 16 : 10;
+  int needed = (int)(n / loadFactor) + 1;
+  while ((int)(loadFactor * needed) < n)
+    needed++;
+  needed = max(needed, minCapacity);
+  if (!powerOfTwo)
+    return needed;
+  int pow2 = minCapacity;
+  while (pow2 < needed)
+    pow2 <<= 1;
+  return pow2;
+}
+
+template <class K, class V>
+void xMap<K, V>::reserve(int n)
+{
+  int newCapacity = capacityFor(n);
+  if (newCapacity > capacity)
+    rehashAll(newCapacity);
+}
+
+template <class K, class V>
+void xMap<K, V>::shrink_to_fit()
+{
+  finishRehash();
+  int newCapacity = capacityFor(count);
+  if (newCapacity < capacity)
+    rehashAll(newCapacity);
+}
+
 /*
  * rehash(int newCapacity)
  *  Purpose:
@@ -701,23 +1247,213 @@ void xMap<K, V>::ensureLoadFactor(int current_size)
 template <class K, class V>
 void xMap<K, V>::rehash(int newCapacity)
 {
-  DLinkedList<Entry *> *pOldMap = this->table;
+  // at most one incremental rehash at a time
+  finishRehash();
+  if (stats != 0)
+    stats->recordRehash(count, capacity, newCapacity);
+  chrono::steady_clock::time_point start;
+  if (stats != 0)
+    start = chrono::steady_clock::now();
+
+  IntrusiveList<Entry> *pOldMap = this->table;
   int oldCapacity = capacity;
 
+  if (rehashStep > 0)
+  {
+    // incremental: only reserve the new table, rehashSome builds and fills it
+    this->oldTable = pOldMap;
+    this->oldCapacity = oldCapacity;
+    this->migrated = 0;
+    this->built = 0;
+    this->table = (IntrusiveList<Entry> *)::operator new(sizeof(IntrusiveList<Entry>) * newCapacity);
+    this->capacity = newCapacity;
+    if (stats != 0)
+      stats->rehashMillis += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    return;
+  }
+
   // Create new table:
-  this->table = new DLinkedList<Entry *>[newCapacity];
+  this->table = newTable(newCapacity);
   this->capacity = newCapacity; // keep "count" not changed
 
+  // entries are relinked, not copied: the old buckets end up empty
   moveEntries(pOldMap, oldCapacity, this->table, newCapacity);
 
-  // remove old data: only remove nodes in list, no entry
-  for (int idx = 0; idx < oldCapacity; idx++)
+  // Remove oldTable
+  deleteTable(pOldMap, oldCapacity);
+  if (stats != 0)
+    stats->rehashMillis += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+/*
+ * rehashAll(int newCapacity): rehash() at once, even with setIncrementalRehash
+ */
+template <class K, class V>
+void xMap<K, V>::rehashAll(int newCapacity)
+{
+  int step = rehashStep;
+  rehashStep = 0;
+  rehash(newCapacity);
+  rehashStep = step;
+}
+
+/*
+ * rehashSome(int steps): advance the incremental rehash by "steps":
+ *  construct up to steps * BUILD_PER_STEP buckets of the new table; once it is built,
+ *  move up to "steps" non-empty old buckets (passing at most steps * BUILD_PER_STEP
+ *  old buckets); free the old table after the last one
+ */
+template <class K, class V>
+void xMap<K, V>::rehashSome(int steps)
+{
+  if (oldTable == 0)
+    return;
+  if (stats != 0)
   {
-    DLinkedList<Entry *> &list = pOldMap[idx];
-    list.clear();
+    // time the step: the same work without stats
+    HashMapStats *pStats = stats;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    stats = 0;
+    rehashSome(steps);
+    stats = pStats;
+    stats->rehashMillis += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    return;
   }
-  // Remove oldTable
-  delete[] pOldMap;
+  if (built < capacity)
+  {
+    int end = min(capacity, built + steps * BUILD_PER_STEP);
+    for (; built < end; built++)
+      new (&table[built]) IntrusiveList<Entry>();
+    return;
+  }
+
+  // empty buckets are cheap: they count towards the BUILD_PER_STEP budget only
+  // (a shrink after mass removes leaves mostly empty buckets behind)
+  int end = min(oldCapacity, migrated + steps * BUILD_PER_STEP), moved = 0;
+  for (; migrated < end && moved < steps; migrated++)
+  {
+    IntrusiveList<Entry> &oldList = oldTable[migrated];
+    if (!oldList.empty())
+      moved++;
+    while (!oldList.empty())
+    {
+      Entry *oldEntry = oldList.removeAt(0);
+      table[indexOf(oldEntry->key, oldEntry->hash, capacity)].add(oldEntry);
+    }
+    oldList.~IntrusiveList<Entry>();
+  }
+  if (migrated == oldCapacity)
+  {
+    ::operator delete(oldTable);
+    oldTable = 0;
+  }
+}
+
+/*
+ * finishRehash(): complete the incremental rehash in progress, if any
+ */
+template <class K, class V>
+void xMap<K, V>::finishRehash()
+{
+  while (oldTable != 0)
+    rehashSome(oldCapacity + capacity);
+}
+
+/*
+ * newTable(capacity), deleteTable(table, capacity): a table of empty buckets;
+ *  raw storage with the buckets constructed in place, so that an incremental
+ *  rehash can construct and destroy them a few at a time
+ */
+template <class K, class V>
+IntrusiveList<typename xMap<K, V>::Entry> *xMap<K, V>::newTable(int capacity)
+{
+  IntrusiveList<Entry> *table =
+      (IntrusiveList<Entry> *)::operator new(sizeof(IntrusiveList<Entry>) * capacity);
+  for (int idx = 0; idx < capacity; idx++)
+    new (&table[idx]) IntrusiveList<Entry>();
+  return table;
+}
+
+template <class K, class V>
+void xMap<K, V>::deleteTable(IntrusiveList<Entry> *table, int capacity)
+{
+  for (int idx = 0; idx < capacity; idx++)
+    table[idx].~IntrusiveList<Entry>();
+  ::operator delete(table);
+}
+
+/*
+ * enableStats(bool enable), getStats(): see the declaration
+ */
+template <class K, class V>
+void xMap<K, V>::enableStats(bool enable)
+{
+  delete stats;
+  stats = enable ? new HashMapStats() : 0;
+}
+
+template <class K, class V>
+HashMapStats xMap<K, V>::getStats()
+{
+  HashMapStats result;
+  if (stats != 0)
+    result = *stats;
+  result.count = count;
+  result.capacity = capacity;
+  result.bucketHistogram.assign(HashMapStats::MAX_LENGTH + 1, 0);
+  // the buckets in use: during an incremental rehash, some of each table
+  int last = oldTable != 0 ? built : capacity;
+  for (int idx = 0; idx < last; idx++)
+    result.bucketHistogram[min(table[idx].size(), (int)HashMapStats::MAX_LENGTH)]++;
+  if (oldTable != 0)
+    for (int idx = migrated; idx < oldCapacity; idx++)
+      result.bucketHistogram[min(oldTable[idx].size(), (int)HashMapStats::MAX_LENGTH)]++;
+
+  result.bytes = sizeof(*this) + (long long)capacity * sizeof(IntrusiveList<Entry>) +
+                 (long long)count * sizeof(Entry);
+  if (oldTable != 0)
+    result.bytes += (long long)oldCapacity * sizeof(IntrusiveList<Entry>);
+  return result;
+}
+
+/*
+ * setIncrementalRehash(int step): see the declaration
+ */
+template <class K, class V>
+void xMap<K, V>::setIncrementalRehash(int step)
+{
+  if (step <= 0)
+  {
+    finishRehash();
+    step = 0;
+  }
+  rehashStep = step;
+}
+
+/*
+ * setPowerOfTwo(bool enable): switch the indexing mode,
+ *  recompute the cached hash of every entry and rehash the table
+ */
+template <class K, class V>
+void xMap<K, V>::setPowerOfTwo(bool enable)
+{
+  if (enable == powerOfTwo)
+    return;
+  finishRehash();
+  powerOfTwo = enable;
+  for (int idx = 0; idx < capacity; idx++)
+    for (auto pEntry : table[idx])
+      pEntry->hash = hashOf(pEntry->key);
+
+  int newCapacity = capacity;
+  if (enable)
+  {
+    newCapacity = 16;
+    while (newCapacity < capacity)
+      newCapacity <<= 1;
+  }
+  // the buckets were placed with the other mode: rehash all at once
+  rehashAll(newCapacity);
 }
 
 /*
@@ -731,6 +1467,8 @@ void xMap<K, V>::rehash(int newCapacity)
 template <class K, class V>
 void xMap<K, V>::removeInternalData()
 {
+  finishRehash();
+
   // Remove user's data
   if (deleteKeys != 0)
     deleteKeys(this);
@@ -740,14 +1478,46 @@ void xMap<K, V>::removeInternalData()
   // Remove all entries in the current map
   for (int idx = 0; idx < this->capacity; idx++)
   {
-    DLinkedList<Entry *> &list = this->table[idx];
-    for (auto pEntry : list)
-      delete pEntry;
-    list.clear();
+    IntrusiveList<Entry>::free(&this->table[idx]);
   }
 
   // Remove table
-  delete[] table;
+  deleteTable(table, capacity);
+}
+
+/*
+ * copyTableFrom(const xMap<K,V>& map):
+ *  Purpose: allocate a table of map.capacity buckets and copy the entries of map
+ *      (including the ones an incremental rehash in map has not moved yet)
+ */
+template <class K, class V>
+void xMap<K, V>::copyTableFrom(const xMap<K, V> &map)
+{
+  this->oldTable = 0;
+  this->table = newTable(this->capacity);
+
+  // buckets of map.table that are constructed: same index
+  int builtBuckets = map.oldTable != 0 ? map.built : map.capacity;
+  for (int i = 0; i < builtBuckets; i++)
+  {
+    for (auto srcEntry : map.table[i])
+    {
+      Entry *newEntry = new Entry(srcEntry->key, srcEntry->value, srcEntry->hash);
+      this->table[i].add(newEntry);
+    }
+  }
+  // entries still in map.oldTable: index for the new capacity
+  if (map.oldTable != 0)
+  {
+    for (int i = map.migrated; i < map.oldCapacity; i++)
+    {
+      for (auto srcEntry : map.oldTable[i])
+      {
+        Entry *newEntry = new Entry(srcEntry->key, srcEntry->value, srcEntry->hash);
+        this->table[indexOf(newEntry->key, newEntry->hash, this->capacity)].add(newEntry);
+      }
+    }
+  }
 }
 
 /*
@@ -765,7 +1535,11 @@ void xMap<K, V>::copyMapFrom(const xMap<K, V> &map)
 
   this->capacity = map.capacity;
   this->count = 0;
-  this->table = new DLinkedList<Entry *>[capacity];
+  this->powerOfTwo = map.powerOfTwo;
+  this->rehashStep = map.rehashStep;
+  this->shrinkLoad = map.shrinkLoad;
+  this->oldTable = 0;
+  this->table = newTable(capacity);
 
   this->hashCode = hashCode;
   this->loadFactor = loadFactor;
@@ -777,7 +1551,7 @@ void xMap<K, V>::copyMapFrom(const xMap<K, V> &map)
   // copy entries
   for (int idx = 0; idx < map.capacity; idx++)
   {
-    DLinkedList<Entry *> &list = map.table[idx];
+    IntrusiveList<Entry> &list = map.table[idx];
     for (auto pEntry : list)
     {
       this->put(pEntry->key, pEntry->value);
@@ -0,0 +1,358 @@
+/*
+ * File:   DaryHeap.h
+ *
+ * DaryHeap<T, Arity, Compare>: a heap where each node has Arity children (2, 4 or 8),
+ *  for large heaps where Heap<T> (binary, comparator called through a pointer) is
+ *  bound by cache misses:
+ *  + a node's children are contiguous and the array is laid out so that they start
+ *      on a cache line: reheapDown reads one line per level, and there are
+ *      log_Arity(n) levels instead of log_2(n)
+ *  + Compare is a functor type, inlined: Compare()(a, b) is true when a must be
+ *      closer to the top than b. std::less<T> (default) gives a min-heap like Heap<T>;
+ *      a comparator function of Heap<T> can be used through HeapComparator:
+ *          DaryHeap<int, 4, HeapComparator<int, &maxHeapComparator>> maxHeap;
+ *  + reheapUp/reheapDown move a hole instead of swapping; reheapDown picks the best
+ *      child with conditional moves and prefetches the next level
+ */
+
+#ifndef DARYHEAP_H
+#define DARYHEAP_H
+#include <iostream>
+#include <sstream>
+#include <functional>
+#include <new>
+#include <utility>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include "heap/IHeap.h"
+
+/*
+ * HeapComparator: the functor of a comparator function as in Heap.h
+ *  (int (*comparator)(T& lhs, T& rhs): sign of lhs - rhs, the smallest on top)
+ */
+template<class T, int (*comparator)(T&, T&)>
+struct HeapComparator{
+    bool operator()(T& lhs, T& rhs) const{
+        return comparator(lhs, rhs) < 0;
+    }
+};
+
+template<class T, int Arity=4, class Compare=std::less<T> >
+class DaryHeap: public IHeap<T>{
+    static_assert(Arity >= 2, "DaryHeap: Arity must be at least 2");
+
+protected:
+    static const int CACHE_LINE = 64;
+    static const int OFFSET = Arity - 1; //storage slots before the root: children start at multiples of Arity
+    static constexpr size_t ALIGNMENT = alignof(T) > CACHE_LINE ? alignof(T) : CACHE_LINE;
+
+    T *storage;     //aligned on a cache line, capacity + OFFSET slots
+    T *elements;    //storage + OFFSET: the heap, elements[0] is the top; [0, count) are constructed
+    int capacity;
+    int count;
+    Compare before; //before(a, b): a must be closer to the top than b
+    void (*deleteUserData)(DaryHeap<T, Arity, Compare>* pHeap); //see Heap.h
+
+public:
+    DaryHeap(   Compare compare=Compare(),
+                void (*deleteUserData)(DaryHeap<T, Arity, Compare>*)=0 );
+    DaryHeap(const DaryHeap<T, Arity, Compare>& heap);
+    DaryHeap<T, Arity, Compare>& operator=(const DaryHeap<T, Arity, Compare>& heap);
+    ~DaryHeap();
+
+    //Inherit from IHeap: BEGIN
+    void push(T item);
+    T pop();
+    const T peek();
+    void remove(T item, void (*removeItemData)(T)=0);
+    bool contains(T item);
+    int size(){
+        return count;
+    }
+    void heapify(T array[], int size); //see pushAll
+    void clear();
+    bool empty(){
+        return count == 0;
+    }
+    string toString(string (*item2str)(T&)=0 );
+    //Inherit from IHeap: END
+
+    /*
+     * replaceTop(item): pop() then push(item) with one reheapDown; return the old top
+     */
+    T replaceTop(T item);
+    /*
+     * pushAll(begin, end): push the items of [begin, end), as Heap<T>::pushAll
+     *  (one allocation; bottom-up rebuild when the batch is not smaller than the heap;
+     *  forward iterators: the range is read twice)
+     * reserve(n): room for n items, allocated once
+     */
+    template<class ForwardIterator>
+    void pushAll(ForwardIterator begin, ForwardIterator end);
+    void reserve(int n){
+        if(n > capacity) reallocate(n);
+    }
+    void println(string (*item2str)(T&)=0 ){
+        cout << toString(item2str) << endl;
+    }
+
+    /* if T is pointer type: see Heap<T>::free */
+    static void free(DaryHeap<T, Arity, Compare> *pHeap){
+        for(int idx=0; idx < pHeap->count; idx++) delete pHeap->elements[idx];
+    }
+
+protected:
+    void ensureCapacity(int minCapacity){
+        if(minCapacity > capacity) reallocate(max(minCapacity, 2*capacity));
+    }
+    void reallocate(int newCapacity);
+    void reheapUp(int position, T item);
+    void reheapDown(int position, T item);
+    void buildHeap();
+    void copyFrom(const DaryHeap<T, Arity, Compare>& heap);
+    void removeInternalData();
+};
+
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template<class T, int Arity, class Compare>
+DaryHeap<T, Arity, Compare>::DaryHeap(
+        Compare compare,
+        void (*deleteUserData)(DaryHeap<T, Arity, Compare>*) ): before(compare){
+    this->storage = 0;
+    this->elements = 0;
+    this->capacity = 0;
+    this->count = 0;
+    this->deleteUserData = deleteUserData;
+    reallocate(16);
+}
+
+template<class T, int Arity, class Compare>
+DaryHeap<T, Arity, Compare>::DaryHeap(const DaryHeap<T, Arity, Compare>& heap): before(heap.before){
+    copyFrom(heap);
+}
+
+template<class T, int Arity, class Compare>
+DaryHeap<T, Arity, Compare>& DaryHeap<T, Arity, Compare>::operator=(const DaryHeap<T, Arity, Compare>& heap){
+    if(this != &heap){
+        removeInternalData();
+        before = heap.before;
+        copyFrom(heap);
+    }
+    return *this;
+}
+
+template<class T, int Arity, class Compare>
+DaryHeap<T, Arity, Compare>::~DaryHeap(){
+    removeInternalData();
+}
+
+template<class T, int Arity, class Compare>
+void DaryHeap<T, Arity, Compare>::push(T item){
+    ensureCapacity(count + 1);
+    new (&elements[count]) T(std::move(item));
+    count += 1;
+    reheapUp(count - 1, std::move(elements[count - 1]));
+}
+
+template<class T, int Arity, class Compare>
+T DaryHeap<T, Arity, Compare>::pop(){
+    if(count == 0)
+        throw std::underflow_error("Calling to pop with the empty heap.");
+
+    T item = std::move(elements[0]);
+    count -= 1;
+    T last = std::move(elements[count]);
+    elements[count].~T();
+    if(count > 0) reheapDown(0, std::move(last));
+    return item;
+}
+
+template<class T, int Arity, class Compare>
+T DaryHeap<T, Arity, Compare>::replaceTop(T item){
+    if(count == 0)
+        throw std::underflow_error("Calling to replaceTop with the empty heap.");
+
+    T top = std::move(elements[0]);
+    reheapDown(0, std::move(item));
+    return top;
+}
+
+template<class T, int Arity, class Compare>
+const T DaryHeap<T, Arity, Compare>::peek(){
+    if(count == 0)
+        throw std::underflow_error("Calling to peek with the empty heap.");
+    return elements[0];
+}
+
+template<class T, int Arity, class Compare>
+void DaryHeap<T, Arity, Compare>::remove(T item, void (*removeItemData)(T)){
+    int foundIdx = -1;
+    for(int idx=0; idx < count && foundIdx == -1; idx++){
+        if(elements[idx] == item) foundIdx = idx;
+    }
+    if(foundIdx == -1) return;
+
+    if(removeItemData != 0) removeItemData(elements[foundIdx]);
+    //the last item takes the place: it may go either up or down
+    count -= 1;
+    T last = std::move(elements[count]);
+    elements[count].~T();
+    if(foundIdx == count) return;
+    if(foundIdx > 0 && before(last, elements[(foundIdx - 1)/Arity]))
+        reheapUp(foundIdx, std::move(last));
+    else
+        reheapDown(foundIdx, std::move(last));
+}
+
+template<class T, int Arity, class Compare>
+bool DaryHeap<T, Arity, Compare>::contains(T item){
+    for(int idx=0; idx < count; idx++){
+        if(elements[idx] == item) return true;
+    }
+    return false;
+}
+
+template<class T, int Arity, class Compare>
+void DaryHeap<T, Arity, Compare>::heapify(T array[], int size){
+    pushAll(array, array + size);
+}
+
+template<class T, int Arity, class Compare>
+template<class ForwardIterator>
+void DaryHeap<T, Arity, Compare>::pushAll(ForwardIterator begin, ForwardIterator end){
+    int size = std::distance(begin, end);
+    reserve(count + size);
+    if(size < count){
+        //a small batch: reheapUp each item
+        for(; begin != end; ++begin) push(*begin);
+        return;
+    }
+    for(; begin != end; ++begin) new (&elements[count++]) T(*begin);
+    buildHeap();
+}
+
+template<class T, int Arity, class Compare>
+void DaryHeap<T, Arity, Compare>::clear(){
+    if(deleteUserData != 0) deleteUserData(this);
+    for(int idx=0; idx < count; idx++) elements[idx].~T();
+    count = 0;
+}
+
+template<class T, int Arity, class Compare>
+string DaryHeap<T, Arity, Compare>::toString(string (*item2str)(T&)){
+    stringstream os;
+    os << "[";
+    for(int idx=0; idx < count; idx++){
+        if(idx > 0) os << ",";
+        if(item2str != 0) os << item2str(elements[idx]);
+        else os << elements[idx];
+    }
+    os << "]";
+    return os.str();
+}
+
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// (private) METHOD DEFNITION //////////////////
+//////////////////////////////////////////////////////////////////////
+
+template<class T, int Arity, class Compare>
+void DaryHeap<T, Arity, Compare>::reallocate(int newCapacity){
+    T *newStorage = static_cast<T*>(::operator new((newCapacity + OFFSET)*sizeof(T), std::align_val_t(ALIGNMENT)));
+    T *newElements = newStorage + OFFSET;
+    for(int idx=0; idx < count; idx++){
+        new (&newElements[idx]) T(std::move(elements[idx]));
+        elements[idx].~T();
+    }
+    if(storage != 0) ::operator delete(storage, std::align_val_t(ALIGNMENT));
+    storage = newStorage;
+    elements = newElements;
+    capacity = newCapacity;
+}
+
+/*
+ * reheapUp: put item at position (whose slot is a hole), then move it up;
+ *  the parents it passes move down into the hole
+ */
+template<class T, int Arity, class Compare>
+void DaryHeap<T, Arity, Compare>::reheapUp(int position, T item){
+    while(position > 0){
+        int parent = (position - 1)/Arity;
+        if(!before(item, elements[parent])) break;
+        elements[position] = std::move(elements[parent]);
+        position = parent;
+    }
+    elements[position] = std::move(item);
+}
+
+/*
+ * reheapDown: put item at position (whose slot is a hole), then move it down;
+ *  the first child that must be above it moves up into the hole
+ */
+template<class T, int Arity, class Compare>
+void DaryHeap<T, Arity, Compare>::reheapDown(int position, T item){
+    while(true){
+        int firstChild = Arity*position + 1;
+        if(firstChild >= count) break;
+        //the grandchildren are contiguous too: fetch them while the children are compared
+        int firstGrandchild = Arity*firstChild + 1;
+        if(firstGrandchild < count){
+            const char *lines = (const char*)&elements[firstGrandchild];
+            const char *end = (const char*)&elements[min(firstGrandchild + Arity*Arity, count)];
+            for(; lines < end; lines += CACHE_LINE) __builtin_prefetch(lines);
+        }
+        T *best = &elements[firstChild];
+        if(firstChild + Arity <= count){
+            //all children present: a fixed-length loop, unrolled by the compiler;
+            //the conditional move avoids a mispredicted branch per child
+            for(T *child=best + 1; child < &elements[firstChild + Arity]; child++)
+                best = before(*child, *best) ? child : best;
+        }
+        else{
+            for(T *child=best + 1; child < &elements[count]; child++)
+                best = before(*child, *best) ? child : best;
+        }
+        int bestChild = best - elements;
+        if(!before(elements[bestChild], item)) break;
+        elements[position] = std::move(elements[bestChild]);
+        position = bestChild;
+    }
+    elements[position] = std::move(item);
+}
+
+/*
+ * buildHeap: Floyd's bottom-up build, O(n): reheapDown every parent, last one first
+ */
+template<class T, int Arity, class Compare>
+void DaryHeap<T, Arity, Compare>::buildHeap(){
+    for(int position = (count - 2)/Arity; count > 1 && position >= 0; position--)
+        reheapDown(position, std::move(elements[position]));
+}
+
+template<class T, int Arity, class Compare>
+void DaryHeap<T, Arity, Compare>::copyFrom(const DaryHeap<T, Arity, Compare>& heap){
+    this->storage = 0;
+    this->elements = 0;
+    this->capacity = 0;
+    this->count = 0;
+    this->deleteUserData = heap.deleteUserData;
+    reallocate(max(heap.capacity, 16));
+    for(int idx=0; idx < heap.count; idx++) new (&elements[idx]) T(heap.elements[idx]);
+    this->count = heap.count;
+}
+
+template<class T, int Arity, class Compare>
+void DaryHeap<T, Arity, Compare>::removeInternalData(){
+    clear(); //clear users's data if they want
+    ::operator delete(storage, std::align_val_t(ALIGNMENT));
+    storage = 0;
+    elements = 0;
+    capacity = 0;
+}
+
+#endif /* DARYHEAP_H */
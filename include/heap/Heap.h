@@ -15,7 +15,11 @@
 #define HEAP_H
 #include <memory.h>
 #include "heap/IHeap.h"
+#include <iostream>
 #include <sstream>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
 /*
  * function pointer: int (*comparator)(T& lhs, T& rhs)
  *      compares objects of type T given in lhs and rhs.
@@ -38,6 +42,7 @@ protected:
     T *elements;    //a dynamic array to contain user's data
     int capacity;   //size of the dynamic array
     int count;      //current count of elements stored in this heap
+    bool ownsElements; //false: elements is the caller's array (see Heap(array, n, ...))
     int (*comparator)(T& lhs, T& rhs);      //see above
     void (*deleteUserData)(Heap<T>* pHeap); //see above
     
@@ -45,6 +50,15 @@ public:
     Heap(   int (*comparator)(T& , T&)=0, 
             void (*deleteUserData)(Heap<T>*)=0 );
     
+    /*
+     * Heap(array, n, comparator): a heap of the n items of array, built in place
+     *  in O(n) (bottom-up): array is reordered and used as the heap's storage,
+     *  not copied. It must outlive the heap, which never deletes it; once the heap
+     *  grows beyond n items, it moves to an array of its own.
+     */
+    Heap(   T* array, int n,
+            int (*comparator)(T& , T&)=0, 
+            void (*deleteUserData)(Heap<T>*)=0 );
     Heap(const Heap<T>& heap); //copy constructor 
     Heap<T>& operator=(const Heap<T>& heap); //assignment operator
     
@@ -57,12 +71,22 @@ public:
     void remove(T item, void (*removeItemData)(T)=0);
     bool contains(T item);
     int size();
-    void heapify(T array[], int size);
+    void heapify(T array[], int size); //see pushAll
     void clear();
     bool empty();
     string toString(string (*item2str)(T&)=0 );
     //Inherit from IHeap: END
     
+    /*
+     * pushAll(begin, end): push the items of [begin, end); the storage grows once,
+     *  and when the batch is at least as large as the heap, the whole heap is
+     *  rebuilt bottom-up in O(n) instead of n reheapUp.
+     *  The range is read twice (counted, then copied): forward iterators or better,
+     *  not single-pass ones such as istream_iterator
+     */
+    template<class ForwardIterator>
+    void pushAll(ForwardIterator begin, ForwardIterator end);
+    
     void println(string (*item2str)(T&)=0 ){
         cout << toString(item2str) << endl;
     }
@@ -104,6 +128,7 @@ private:
     void swap(int a, int b);
     void reheapUp(int position);
     void reheapDown(int position);
+    void buildHeap();
     int getItem(T item);
     
     void removeInternalData();
@@ -166,28 +191,52 @@ template<class T>
 Heap<T>::Heap(
         int (*comparator)(T&, T&), 
         void (*deleteUserData)(Heap<T>* ) ){
-    //YOUR CODE IS HERE
+    this->capacity = 10;
+    this->count = 0;
+    this->elements = new T[capacity];
+    this->ownsElements = true;
+    this->comparator = comparator;
+    this->deleteUserData = deleteUserData;
+}
+template<class T>
+Heap<T>::Heap(
+        T* array, int n,
+        int (*comparator)(T&, T&), 
+        void (*deleteUserData)(Heap<T>* ) ){
+    this->capacity = n;
+    this->count = n;
+    this->elements = array;
+    this->ownsElements = false;
+    this->comparator = comparator;
+    this->deleteUserData = deleteUserData;
+    buildHeap();
 }
 template<class T>
 Heap<T>::Heap(const Heap<T>& heap){
-    //YOUR CODE IS HERE
+    copyFrom(heap);
 }
 
 template<class T>
 Heap<T>& Heap<T>::operator=(const Heap<T>& heap){
-    //YOUR CODE IS HERE
+    if(this != &heap){
+        removeInternalData();
+        copyFrom(heap);
+    }
     return *this;
 }
 
 
 template<class T>
 Heap<T>::~Heap(){
-    //YOUR CODE IS HERE
+    removeInternalData();
 }
 
 template<class T>
 void Heap<T>::push(T item){ //item  = 25
-    //YOUR CODE IS HERE
+    ensureCapacity(count + 1);
+    elements[count] = item;
+    count += 1;
+    reheapUp(count - 1);
 }
 /*
       18
@@ -207,7 +256,14 @@ void Heap<T>::push(T item){ //item  = 25
  */
 template<class T>
 T Heap<T>::pop(){
-    //YOUR CODE IS HERE
+    if(count == 0) 
+        throw std::underflow_error("Calling to pop with the empty heap.");
+    
+    T item = elements[0];
+    elements[0] = elements[count - 1];
+    count -= 1;
+    reheapDown(0);
+    return item;
 }
 
 /*
@@ -223,38 +279,69 @@ T Heap<T>::pop(){
 
 template<class T>
 const T Heap<T>::peek(){
-    //YOUR CODE IS HERE
+    if(count == 0) 
+        throw std::underflow_error("Calling to peek with the empty heap.");
+    return elements[0];
 }
 
 
 template<class T>
 void Heap<T>::remove(T item, void (*removeItemData)(T)){
-    //YOUR CODE IS HERE
+    int foundIdx = getItem(item);
+    if(foundIdx == -1) return;
+    
+    if(removeItemData != 0) removeItemData(elements[foundIdx]);
+    //the last item takes the place: it may go either up or down
+    elements[foundIdx] = elements[count - 1];
+    count -= 1;
+    if(foundIdx < count){
+        reheapUp(foundIdx);
+        reheapDown(foundIdx);
+    }
 }
 
 template<class T>
 bool Heap<T>::contains(T item){
-    //YOUR CODE IS HERE
+    return getItem(item) != -1;
 }
 
 template<class T>
 int Heap<T>::size(){
-    //YOUR CODE IS HERE
+    return count;
 }
 
 template<class T>
 void Heap<T>::heapify(T array[], int size){
-    //YOUR CODE IS HERE
+    pushAll(array, array + size);
+}
+
+template<class T>
+template<class ForwardIterator>
+void Heap<T>::pushAll(ForwardIterator begin, ForwardIterator end){
+    int size = std::distance(begin, end);
+    ensureCapacity(count + size);
+    if(size < count){
+        //a small batch: reheapUp each item
+        for(; begin != end; ++begin) push(*begin);
+        return;
+    }
+    for(; begin != end; ++begin) elements[count++] = *begin;
+    buildHeap();
 }
 
 template<class T>
 void Heap<T>::clear(){
-    //YOUR CODE IS HERE
+    removeInternalData();
+    
+    capacity = 10;
+    count = 0;
+    elements = new T[capacity];
+    ownsElements = true;
 }
 
 template<class T>
 bool Heap<T>::empty(){
-    //YOUR CODE IS HERE
+    return count == 0;
 }
 
 template<class T>
@@ -285,19 +372,14 @@ string Heap<T>::toString(string (*item2str)(T&)){
 template<class T>
 void Heap<T>::ensureCapacity(int minCapacity){
     if(minCapacity >= capacity){
-        //re-allocate 
+        //re-allocate once, to at least minCapacity (a batch may need more than 25% more)
         int old_capacity = capacity;
-        capacity = old_capacity + (old_capacity >> 2);
-        try{
-            T* new_data = new T[capacity];
-            //OLD: memcpy(new_data, elements, capacity*sizeof(T));
-            memcpy(new_data, elements, old_capacity*sizeof(T));
-            delete []elements;
-            elements = new_data;
-        }
-        catch(std::bad_alloc e){
-            e.what();
-        }
+        capacity = max(minCapacity, old_capacity + (old_capacity >> 2) + 1);
+        T* new_data = new T[capacity];
+        for(int idx=0; idx < count; idx++) new_data[idx] = std::move(elements[idx]);
+        if(ownsElements) delete []elements;
+        elements = new_data;
+        ownsElements = true;
     }
 }
 
@@ -310,23 +392,54 @@ void Heap<T>::swap(int a, int b){
 
 template<class T>
 void Heap<T>::reheapUp(int position){
-    //YOUR CODE IS HERE
+    if(position <= 0) return;
+    int parent = (position - 1)/2;
+    if(aLTb(elements[position], elements[parent])){
+        swap(position, parent);
+        reheapUp(parent);
+    }
 }
 
 template<class T>
 void Heap<T>::reheapDown(int position){
-    //YOUR CODE IS HERE
+    int leftChild = position*2 + 1;
+    int rightChild = position*2 + 2;
+    int lastPosition = count - 1;
+    
+    if(leftChild <= lastPosition){
+        int smallChild = leftChild; //assume: left child is smaller
+        if(rightChild <= lastPosition){
+            if(aLTb(elements[rightChild], elements[leftChild])) smallChild = rightChild;
+        }
+        
+        if(aLTb(elements[smallChild], elements[position])){
+            swap(smallChild, position);
+            reheapDown(smallChild);
+        }
+    }
+}
+
+/*
+ * buildHeap: Floyd's bottom-up build: reheapDown every parent, from the last one
+ *  to the root; O(n), against O(n log n) for n reheapUp
+ */
+template<class T>
+void Heap<T>::buildHeap(){
+    for(int position = count/2 - 1; position >= 0; position--) reheapDown(position);
 }
 
 template<class T>
 int Heap<T>::getItem(T item){
-    //YOUR CODE IS HERE
+    for(int idx=0; idx < count; idx++){
+        if(elements[idx] == item) return idx;
+    }
+    return -1;
 }
 
 template<class T>
 void Heap<T>::removeInternalData(){
     if(this->deleteUserData != 0) deleteUserData(this); //clear users's data if they want
-    delete []elements;
+    if(ownsElements) delete []elements;
 }
 
 template<class T>
@@ -334,11 +447,12 @@ void Heap<T>::copyFrom(const Heap<T>& heap){
     capacity = heap.capacity;
     count = heap.count;
     elements = new T[capacity];
+    ownsElements = true;
     this->comparator = heap.comparator;
     this->deleteUserData = heap.deleteUserData;
     
     //Copy items from heap:
-    for(int idx=0; idx < heap.size(); idx++){
+    for(int idx=0; idx < heap.count; idx++){
         this->elements[idx] = heap.elements[idx];
     }
 }
@@ -0,0 +1,362 @@
+/*
+ * File:   IndexedHeap.h
+ *
+ * IndexedHeap<T>: a heap (same order as Heap<T>: the comparator decides the top)
+ *  that knows where each element is
+ *  + insert(item) returns a handle: it stays attached to the item, wherever
+ *      reheapUp/reheapDown move it, until the item leaves the heap (pop, erase,
+ *      remove, clear); handles of removed items are reused
+ *  + with the handle: get, decreaseKey, increaseKey, update, erase in O(log n),
+ *      containsHandle in O(1)
+ *  + with an itemId hook (int (*itemId)(T& item)): each item has a fixed id >= 0,
+ *      e.g. the index of a vertex, used as its handle; then contains(item) is O(1)
+ *      and remove(item) O(log n). Without it, they scan the heap as Heap<T> does.
+ *  For example (Dijkstra):
+ *      IndexedHeap<VertexDist> queue(&distComparator, &vertexId);
+ *      queue.push(VertexDist{source, 0});
+ *      ...
+ *      if(!queue.containsHandle(v)) queue.push(VertexDist{v, d});
+ *      else queue.decreaseKey(v, VertexDist{v, d});
+ */
+
+#ifndef INDEXEDHEAP_H
+#define INDEXEDHEAP_H
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <stdexcept>
+#include "heap/IHeap.h"
+
+template<class T>
+class IndexedHeap: public IHeap<T>{
+protected:
+    struct Node{
+        T item;
+        int handle;
+    };
+    vector<Node> nodes;       //the heap: nodes[0] is the top
+    vector<int> position;     //position[handle]: index in nodes, -1: not in the heap
+    vector<int> freeHandles;  //handles to reuse (no itemId hook only)
+    int (*comparator)(T& lhs, T& rhs);               //see Heap.h
+    int (*itemId)(T& item);                          //see above, 0: handles given by the heap
+    void (*deleteUserData)(IndexedHeap<T>* pHeap);   //see Heap.h
+
+public:
+    IndexedHeap(    int (*comparator)(T& , T&)=0,
+                    int (*itemId)(T&)=0,
+                    void (*deleteUserData)(IndexedHeap<T>*)=0 );
+    ~IndexedHeap();
+
+    //Inherit from IHeap: BEGIN
+    void push(T item); //insert, without the handle
+    T pop();
+    const T peek();
+    void remove(T item, void (*removeItemData)(T)=0);
+    bool contains(T item);
+    int size();
+    void heapify(T array[], int size);
+    void clear();
+    bool empty();
+    string toString(string (*item2str)(T&)=0 );
+    //Inherit from IHeap: END
+
+    /*
+     * insert(item): push item, return its handle;
+     *  with itemId: the handle is itemId(item), already in the heap => invalid_argument
+     * peekHandle(): the handle of the top item
+     */
+    int insert(T item);
+    int peekHandle();
+    /*
+     * Handles that are not in the heap => out_of_range
+     *  + get(handle): the item
+     *  + decreaseKey(handle, item): replace the item by one that is not after it
+     *      (moves towards the top); an item after it => invalid_argument
+     *  + increaseKey(handle, item): the opposite (moves towards the bottom)
+     *  + update(handle, item): replace the item, whichever way it moves
+     *  + erase(handle): remove the item, return it
+     */
+    bool containsHandle(int handle){
+        return handle >= 0 && handle < (int)position.size() && position[handle] != -1;
+    }
+    const T& get(int handle);
+    void decreaseKey(int handle, T item);
+    void increaseKey(int handle, T item);
+    void update(int handle, T item);
+    T erase(int handle);
+
+    void println(string (*item2str)(T&)=0 ){
+        cout << toString(item2str) << endl;
+    }
+
+    /* if T is pointer type: see Heap<T>::free */
+    static void free(IndexedHeap<T> *pHeap){
+        for(int idx=0; idx < (int)pHeap->nodes.size(); idx++) delete pHeap->nodes[idx].item;
+    }
+
+protected:
+    bool aLTb(T& a, T& b){
+        return compare(a, b) < 0;
+    }
+    int compare(T& a, T& b){
+        if(comparator != 0) return comparator(a, b);
+        else{
+            if (a < b) return -1;
+            else if(a > b) return 1;
+            else return 0;
+        }
+    }
+
+    void swap(int a, int b);
+    void reheapUp(int position);
+    void reheapDown(int position);
+    int getItem(T item);
+    int slotOf(int handle);
+    T removeAt(int slot);
+    int newHandle(T& item);
+};
+
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template<class T>
+IndexedHeap<T>::IndexedHeap(
+        int (*comparator)(T&, T&),
+        int (*itemId)(T&),
+        void (*deleteUserData)(IndexedHeap<T>* ) ){
+    this->comparator = comparator;
+    this->itemId = itemId;
+    this->deleteUserData = deleteUserData;
+}
+
+template<class T>
+IndexedHeap<T>::~IndexedHeap(){
+    if(deleteUserData != 0) deleteUserData(this);
+}
+
+template<class T>
+void IndexedHeap<T>::push(T item){
+    insert(item);
+}
+
+template<class T>
+int IndexedHeap<T>::insert(T item){
+    int handle = newHandle(item);
+    nodes.push_back(Node{item, handle});
+    position[handle] = nodes.size() - 1;
+    reheapUp(nodes.size() - 1);
+    return handle;
+}
+
+template<class T>
+T IndexedHeap<T>::pop(){
+    if(nodes.empty())
+        throw std::underflow_error("Calling to pop with the empty heap.");
+    return removeAt(0);
+}
+
+template<class T>
+const T IndexedHeap<T>::peek(){
+    if(nodes.empty())
+        throw std::underflow_error("Calling to peek with the empty heap.");
+    return nodes[0].item;
+}
+
+template<class T>
+int IndexedHeap<T>::peekHandle(){
+    if(nodes.empty())
+        throw std::underflow_error("Calling to peek with the empty heap.");
+    return nodes[0].handle;
+}
+
+template<class T>
+void IndexedHeap<T>::remove(T item, void (*removeItemData)(T)){
+    int foundIdx = getItem(item);
+    if(foundIdx == -1) return;
+
+    if(removeItemData != 0) removeItemData(nodes[foundIdx].item);
+    removeAt(foundIdx);
+}
+
+template<class T>
+bool IndexedHeap<T>::contains(T item){
+    return getItem(item) != -1;
+}
+
+template<class T>
+int IndexedHeap<T>::size(){
+    return nodes.size();
+}
+
+template<class T>
+void IndexedHeap<T>::heapify(T array[], int size){
+    nodes.reserve(nodes.size() + size);
+    for(int idx=0; idx < size; idx++) insert(array[idx]);
+}
+
+template<class T>
+void IndexedHeap<T>::clear(){
+    if(deleteUserData != 0) deleteUserData(this);
+    nodes.clear();
+    position.clear();
+    freeHandles.clear();
+}
+
+template<class T>
+bool IndexedHeap<T>::empty(){
+    return nodes.empty();
+}
+
+template<class T>
+string IndexedHeap<T>::toString(string (*item2str)(T&)){
+    stringstream os;
+    os << "[";
+    for(int idx=0; idx < (int)nodes.size(); idx++){
+        if(idx > 0) os << ",";
+        if(item2str != 0) os << item2str(nodes[idx].item);
+        else os << nodes[idx].item;
+    }
+    os << "]";
+    return os.str();
+}
+
+template<class T>
+const T& IndexedHeap<T>::get(int handle){
+    return nodes[slotOf(handle)].item;
+}
+
+template<class T>
+void IndexedHeap<T>::decreaseKey(int handle, T item){
+    int slot = slotOf(handle);
+    if(aLTb(nodes[slot].item, item))
+        throw std::invalid_argument("decreaseKey: the new item is after the current one");
+    nodes[slot].item = item;
+    reheapUp(slot);
+}
+
+template<class T>
+void IndexedHeap<T>::increaseKey(int handle, T item){
+    int slot = slotOf(handle);
+    if(aLTb(item, nodes[slot].item))
+        throw std::invalid_argument("increaseKey: the new item is before the current one");
+    nodes[slot].item = item;
+    reheapDown(slot);
+}
+
+template<class T>
+void IndexedHeap<T>::update(int handle, T item){
+    int slot = slotOf(handle);
+    nodes[slot].item = item;
+    reheapUp(slot);
+    reheapDown(position[handle]);
+}
+
+template<class T>
+T IndexedHeap<T>::erase(int handle){
+    return removeAt(slotOf(handle));
+}
+
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// (private) METHOD DEFNITION //////////////////
+//////////////////////////////////////////////////////////////////////
+
+template<class T>
+void IndexedHeap<T>::swap(int a, int b){
+    Node temp = nodes[a];
+    nodes[a] = nodes[b];
+    nodes[b] = temp;
+    position[nodes[a].handle] = a;
+    position[nodes[b].handle] = b;
+}
+
+template<class T>
+void IndexedHeap<T>::reheapUp(int position){
+    while(position > 0){
+        int parent = (position - 1)/2;
+        if(!aLTb(nodes[position].item, nodes[parent].item)) break;
+        swap(position, parent);
+        position = parent;
+    }
+}
+
+template<class T>
+void IndexedHeap<T>::reheapDown(int position){
+    int lastPosition = nodes.size() - 1;
+    while(position*2 + 1 <= lastPosition){
+        int smallChild = position*2 + 1; //assume: left child is smaller
+        if(smallChild + 1 <= lastPosition && aLTb(nodes[smallChild + 1].item, nodes[smallChild].item))
+            smallChild += 1;
+        if(!aLTb(nodes[smallChild].item, nodes[position].item)) break;
+        swap(smallChild, position);
+        position = smallChild;
+    }
+}
+
+/*
+ * getItem: index of item in nodes, -1 if not found
+ *  with itemId: looked up by its id; otherwise: a scan with ==
+ */
+template<class T>
+int IndexedHeap<T>::getItem(T item){
+    if(itemId != 0){
+        int handle = itemId(item);
+        return containsHandle(handle) ? position[handle] : -1;
+    }
+    for(int idx=0; idx < (int)nodes.size(); idx++){
+        if(nodes[idx].item == item) return idx;
+    }
+    return -1;
+}
+
+template<class T>
+int IndexedHeap<T>::slotOf(int handle){
+    if(!containsHandle(handle))
+        throw std::out_of_range("Handle is not in the heap!");
+    return position[handle];
+}
+
+/*
+ * removeAt: remove nodes[slot]; the last node takes its place and moves up or down
+ */
+template<class T>
+T IndexedHeap<T>::removeAt(int slot){
+    T item = nodes[slot].item;
+    int handle = nodes[slot].handle;
+    int last = nodes.size() - 1;
+    if(slot != last) swap(slot, last);
+    nodes.pop_back();
+    position[handle] = -1;
+    if(itemId == 0) freeHandles.push_back(handle);
+    if(slot < last){
+        reheapUp(slot);
+        reheapDown(slot);
+    }
+    return item;
+}
+
+template<class T>
+int IndexedHeap<T>::newHandle(T& item){
+    int handle;
+    if(itemId != 0){
+        handle = itemId(item);
+        if(handle < 0)
+            throw std::invalid_argument("IndexedHeap: itemId must be >= 0");
+        if(containsHandle(handle))
+            throw std::invalid_argument("IndexedHeap: an item with this id is already in the heap");
+        if(handle >= (int)position.size()) position.resize(handle + 1, -1);
+    }
+    else if(!freeHandles.empty()){
+        handle = freeHandles.back();
+        freeHandles.pop_back();
+    }
+    else{
+        handle = position.size();
+        position.push_back(-1);
+    }
+    return handle;
+}
+
+#endif /* INDEXEDHEAP_H */
@@ -0,0 +1,351 @@
+/*
+ * File:   PairingHeap.h
+ *
+ * PairingHeap<T, Compare>: a heap-ordered tree of nodes (the smallest, by Compare,
+ *  at the root), for workloads dominated by inserts and decrease-keys (Dijkstra):
+ *  + push/insert and meld: O(1) (one link)
+ *  + decreaseKey: O(1) cut and link (o(log n) amortized)
+ *  + pop: O(log n) amortized (two-pass pairing of the root's children)
+ *  + insert(item) returns a handle (Node*), valid until the item leaves the heap
+ *      (pop, erase, remove, clear); nodes of removed items are reused
+ *  Compare is a functor as in DaryHeap (std::less<T>: a min-heap).
+ */
+
+#ifndef PAIRINGHEAP_H
+#define PAIRINGHEAP_H
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include "heap/IHeap.h"
+
+template<class T, class Compare=std::less<T> >
+class PairingHeap: public IHeap<T>{
+public:
+    class Node; //forward declaration
+
+protected:
+    Node *root;
+    int count;
+    Compare before;               //before(a, b): a must be closer to the root than b
+    vector<Node*> freeNodes;      //nodes to reuse
+    vector<Node*> pairs;          //scratch of pop: the first pass of the pairing
+    void (*deleteUserData)(PairingHeap<T, Compare>* pHeap); //see Heap.h
+
+public:
+    PairingHeap(    Compare compare=Compare(),
+                    void (*deleteUserData)(PairingHeap<T, Compare>*)=0 );
+    PairingHeap(const PairingHeap<T, Compare>& heap) = delete; //handles point into the heap
+    PairingHeap<T, Compare>& operator=(const PairingHeap<T, Compare>& heap) = delete;
+    ~PairingHeap();
+
+    //Inherit from IHeap: BEGIN
+    void push(T item){
+        insert(item);
+    }
+    T pop();
+    const T peek();
+    void remove(T item, void (*removeItemData)(T)=0);
+    bool contains(T item){
+        return find(item) != 0;
+    }
+    int size(){
+        return count;
+    }
+    void heapify(T array[], int size);
+    void clear();
+    bool empty(){
+        return count == 0;
+    }
+    string toString(string (*item2str)(T&)=0 );
+    //Inherit from IHeap: END
+
+    /*
+     * insert(item): push item, return its handle
+     * get(handle): the item
+     * decreaseKey(handle, item): replace the item by one that is not after it;
+     *  an item after it => invalid_argument
+     * erase(handle): remove the item, return it
+     * meld(heap): move all the items of heap (same Compare) into this one, O(1);
+     *  their handles stay valid and now belong to this heap
+     */
+    Node* insert(T item);
+    const T& get(Node* handle){
+        return handle->item;
+    }
+    void decreaseKey(Node* handle, T item);
+    T erase(Node* handle);
+    void meld(PairingHeap<T, Compare>& heap);
+
+    void println(string (*item2str)(T&)=0 ){
+        cout << toString(item2str) << endl;
+    }
+
+    /* if T is pointer type: see Heap<T>::free */
+    static void free(PairingHeap<T, Compare> *pHeap){
+        pHeap->visit([](T& item){ delete item; });
+    }
+
+protected:
+    Node* newNode(T& item);
+    void releaseNode(Node* node);
+    Node* link(Node* a, Node* b);
+    Node* combineSiblings(Node* first);
+    void cut(Node* node);
+    Node* find(T& item);
+    template<class Visit>
+    void visit(Visit visitItem);
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////  INNER CLASSES DEFNITION ////////////////////
+//////////////////////////////////////////////////////////////////////
+
+public:
+    //Node: BEGIN
+    class Node{
+    private:
+        T item;
+        Node *child;    //first child
+        Node *next;     //next sibling
+        Node *prev;     //previous sibling; the parent for a first child
+        friend class PairingHeap<T, Compare>;
+    public:
+        Node(T item): item(item), child(0), next(0), prev(0){}
+    };
+    //Node: END
+};
+
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template<class T, class Compare>
+PairingHeap<T, Compare>::PairingHeap(
+        Compare compare,
+        void (*deleteUserData)(PairingHeap<T, Compare>*) ): before(compare){
+    this->root = 0;
+    this->count = 0;
+    this->deleteUserData = deleteUserData;
+}
+
+template<class T, class Compare>
+PairingHeap<T, Compare>::~PairingHeap(){
+    clear();
+    for(Node* node: freeNodes) delete node;
+}
+
+template<class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::insert(T item){
+    Node* node = newNode(item);
+    root = (root == 0) ? node : link(root, node);
+    count += 1;
+    return node;
+}
+
+template<class T, class Compare>
+T PairingHeap<T, Compare>::pop(){
+    if(count == 0)
+        throw std::underflow_error("Calling to pop with the empty heap.");
+
+    Node* oldRoot = root;
+    T item = oldRoot->item;
+    root = combineSiblings(oldRoot->child);
+    releaseNode(oldRoot);
+    count -= 1;
+    return item;
+}
+
+template<class T, class Compare>
+const T PairingHeap<T, Compare>::peek(){
+    if(count == 0)
+        throw std::underflow_error("Calling to peek with the empty heap.");
+    return root->item;
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::remove(T item, void (*removeItemData)(T)){
+    Node* node = find(item);
+    if(node == 0) return;
+
+    if(removeItemData != 0) removeItemData(node->item);
+    erase(node);
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::heapify(T array[], int size){
+    for(int idx=0; idx < size; idx++) insert(array[idx]);
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::clear(){
+    if(deleteUserData != 0) deleteUserData(this);
+    //release every node: walk the tree with an explicit stack (it can be deep)
+    vector<Node*> stack;
+    if(root != 0) stack.push_back(root);
+    while(!stack.empty()){
+        Node* node = stack.back();
+        stack.pop_back();
+        if(node->child != 0) stack.push_back(node->child);
+        if(node->next != 0) stack.push_back(node->next);
+        releaseNode(node);
+    }
+    root = 0;
+    count = 0;
+}
+
+template<class T, class Compare>
+string PairingHeap<T, Compare>::toString(string (*item2str)(T&)){
+    stringstream os;
+    bool first = true;
+    os << "[";
+    visit([&](T& item){
+        if(!first) os << ",";
+        if(item2str != 0) os << item2str(item);
+        else os << item;
+        first = false;
+    });
+    os << "]";
+    return os.str();
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::decreaseKey(Node* handle, T item){
+    if(before(handle->item, item))
+        throw std::invalid_argument("decreaseKey: the new item is after the current one");
+    handle->item = item;
+    if(handle == root) return;
+    cut(handle);
+    root = link(root, handle);
+}
+
+template<class T, class Compare>
+T PairingHeap<T, Compare>::erase(Node* handle){
+    if(handle == root) return pop();
+
+    T item = handle->item;
+    cut(handle);
+    Node* subtree = combineSiblings(handle->child);
+    if(subtree != 0) root = link(root, subtree);
+    releaseNode(handle);
+    count -= 1;
+    return item;
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::meld(PairingHeap<T, Compare>& heap){
+    if(&heap == this || heap.root == 0) return;
+    root = (root == 0) ? heap.root : link(root, heap.root);
+    count += heap.count;
+    heap.root = 0;
+    heap.count = 0;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// (private) METHOD DEFNITION //////////////////
+//////////////////////////////////////////////////////////////////////
+
+template<class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::newNode(T& item){
+    if(freeNodes.empty()) return new Node(item);
+    Node* node = freeNodes.back();
+    freeNodes.pop_back();
+    node->item = item;
+    node->child = node->next = node->prev = 0;
+    return node;
+}
+
+template<class T, class Compare>
+void PairingHeap<T, Compare>::releaseNode(Node* node){
+    freeNodes.push_back(node);
+}
+
+/*
+ * link: two roots (no siblings) => one tree; the later one becomes the first
+ *  child of the other
+ */
+template<class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::link(Node* a, Node* b){
+    if(before(b->item, a->item)){
+        Node* temp = a;
+        a = b;
+        b = temp;
+    }
+    b->prev = a;
+    b->next = a->child;
+    if(a->child != 0) a->child->prev = b;
+    a->child = b;
+    a->next = a->prev = 0;
+    return a;
+}
+
+/*
+ * combineSiblings: the two-pass pairing of a list of siblings => one tree:
+ *  link them by pairs from left to right, then the pairs from right to left
+ */
+template<class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::combineSiblings(Node* first){
+    if(first == 0) return 0;
+    pairs.clear();
+    while(first != 0){
+        Node* a = first;
+        Node* b = a->next;
+        if(b == 0){
+            a->next = a->prev = 0;
+            pairs.push_back(a);
+            break;
+        }
+        first = b->next;
+        a->next = a->prev = b->next = b->prev = 0;
+        pairs.push_back(link(a, b));
+    }
+    Node* tree = pairs.back();
+    for(int idx=(int)pairs.size() - 2; idx >= 0; idx--) tree = link(pairs[idx], tree);
+    return tree;
+}
+
+/*
+ * cut: detach the subtree of node (not the root) from its parent and siblings
+ */
+template<class T, class Compare>
+void PairingHeap<T, Compare>::cut(Node* node){
+    if(node->prev->child == node) node->prev->child = node->next; //a first child
+    else node->prev->next = node->next;
+    if(node->next != 0) node->next->prev = node->prev;
+    node->next = node->prev = 0;
+}
+
+template<class T, class Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::find(T& item){
+    vector<Node*> stack;
+    if(root != 0) stack.push_back(root);
+    while(!stack.empty()){
+        Node* node = stack.back();
+        stack.pop_back();
+        if(node->item == item) return node;
+        if(node->child != 0) stack.push_back(node->child);
+        if(node->next != 0) stack.push_back(node->next);
+    }
+    return 0;
+}
+
+/*
+ * visit: visitItem(item) for every item, root first (preorder)
+ */
+template<class T, class Compare>
+template<class Visit>
+void PairingHeap<T, Compare>::visit(Visit visitItem){
+    vector<Node*> stack;
+    if(root != 0) stack.push_back(root);
+    while(!stack.empty()){
+        Node* node = stack.back();
+        stack.pop_back();
+        visitItem(node->item);
+        if(node->next != 0) stack.push_back(node->next);
+        if(node->child != 0) stack.push_back(node->child);
+    }
+}
+
+#endif /* PAIRINGHEAP_H */
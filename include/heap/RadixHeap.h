@@ -0,0 +1,236 @@
+/*
+ * File:   RadixHeap.h
+ *
+ * RadixHeap<T, KeyOf>: a monotone min-heap of items with unsigned integer keys,
+ *  for Dijkstra-like workloads where a popped key is never above a later pushed one
+ *  + keyOf(item): the key (uint64_t) of an item; RadixKey<T> (default) is the item
+ *      itself, for unsigned integer T; FloatRadixKey<T> is the bit pattern of a
+ *      non-negative float member or value, which has the order of the floats
+ *  + push: O(1): the item goes to the bucket of the highest bit where its key
+ *      differs from the last popped key
+ *  + pop: O(1) amortized per bit of the key: when bucket 0 is empty, the first
+ *      non-empty bucket is spread into the lower ones; each item moves down at
+ *      most 64 times in all
+ *  + a key below the last popped one => invalid_argument
+ */
+
+#ifndef RADIXHEAP_H
+#define RADIXHEAP_H
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <stdexcept>
+#include <string.h>
+#include <stdint.h>
+#include "heap/IHeap.h"
+
+/*
+ * RadixKey: the key of an unsigned integer item (or of anything convertible to one)
+ */
+template<class T>
+struct RadixKey{
+    uint64_t operator()(const T& item) const{
+        return (uint64_t)item;
+    }
+};
+
+/*
+ * FloatRadixKey: the bit pattern of a non-negative float (not -0.0f); for T = float
+ *  the item, otherwise T::key() (e.g. a (distance, vertex) item whose key() is the
+ *  distance)
+ */
+inline uint64_t floatRadixBits(float value){
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+template<class T>
+struct FloatRadixKey{
+    uint64_t operator()(const T& item) const{
+        return floatRadixBits(item.key());
+    }
+};
+template<>
+struct FloatRadixKey<float>{
+    uint64_t operator()(const float& item) const{
+        return floatRadixBits(item);
+    }
+};
+
+template<class T, class KeyOf=RadixKey<T> >
+class RadixHeap: public IHeap<T>{
+protected:
+    static const int NBUCKETS = 65; //bucket b > 0: keys whose highest bit differing from last is bit b - 1
+
+    struct Entry{
+        uint64_t key;
+        T item;
+    };
+    vector<Entry> buckets[NBUCKETS];
+    uint64_t last;  //the last popped key (0 at first)
+    int count;
+    KeyOf keyOf;
+    void (*deleteUserData)(RadixHeap<T, KeyOf>* pHeap); //see Heap.h
+
+public:
+    RadixHeap(  KeyOf keyOf=KeyOf(),
+                void (*deleteUserData)(RadixHeap<T, KeyOf>*)=0 ): last(0), count(0), keyOf(keyOf){
+        this->deleteUserData = deleteUserData;
+    }
+    ~RadixHeap(){
+        if(deleteUserData != 0) deleteUserData(this);
+    }
+
+    //Inherit from IHeap: BEGIN
+    void push(T item);
+    T pop();
+    const T peek();
+    void remove(T item, void (*removeItemData)(T)=0);
+    bool contains(T item);
+    int size(){
+        return count;
+    }
+    void heapify(T array[], int size);
+    void clear();
+    bool empty(){
+        return count == 0;
+    }
+    string toString(string (*item2str)(T&)=0 );
+    //Inherit from IHeap: END
+
+    /*
+     * lastKey(): the key of the last popped item: no key below it can be pushed
+     */
+    uint64_t lastKey(){
+        return last;
+    }
+    void println(string (*item2str)(T&)=0 ){
+        cout << toString(item2str) << endl;
+    }
+
+    /* if T is pointer type: see Heap<T>::free */
+    static void free(RadixHeap<T, KeyOf> *pHeap){
+        for(int b=0; b < NBUCKETS; b++)
+            for(Entry& entry: pHeap->buckets[b]) delete entry.item;
+    }
+
+protected:
+    int bucketOf(uint64_t key){
+        return key == last ? 0 : 64 - __builtin_clzll(key ^ last);
+    }
+    void refill();
+};
+
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template<class T, class KeyOf>
+void RadixHeap<T, KeyOf>::push(T item){
+    uint64_t key = keyOf(item);
+    if(key < last)
+        throw std::invalid_argument("RadixHeap: the key is below the last popped key");
+    buckets[bucketOf(key)].push_back(Entry{key, item});
+    count += 1;
+}
+
+template<class T, class KeyOf>
+T RadixHeap<T, KeyOf>::pop(){
+    if(count == 0)
+        throw std::underflow_error("Calling to pop with the empty heap.");
+    if(buckets[0].empty()) refill();
+
+    T item = buckets[0].back().item;
+    buckets[0].pop_back();
+    count -= 1;
+    return item;
+}
+
+template<class T, class KeyOf>
+const T RadixHeap<T, KeyOf>::peek(){
+    if(count == 0)
+        throw std::underflow_error("Calling to peek with the empty heap.");
+    if(buckets[0].empty()) refill();
+    return buckets[0].back().item;
+}
+
+template<class T, class KeyOf>
+void RadixHeap<T, KeyOf>::remove(T item, void (*removeItemData)(T)){
+    for(int b=0; b < NBUCKETS; b++){
+        vector<Entry>& bucket = buckets[b];
+        for(int idx=0; idx < (int)bucket.size(); idx++){
+            if(bucket[idx].item == item){
+                if(removeItemData != 0) removeItemData(bucket[idx].item);
+                bucket[idx] = bucket.back();
+                bucket.pop_back();
+                count -= 1;
+                return;
+            }
+        }
+    }
+}
+
+template<class T, class KeyOf>
+bool RadixHeap<T, KeyOf>::contains(T item){
+    for(int b=0; b < NBUCKETS; b++)
+        for(Entry& entry: buckets[b])
+            if(entry.item == item) return true;
+    return false;
+}
+
+template<class T, class KeyOf>
+void RadixHeap<T, KeyOf>::heapify(T array[], int size){
+    for(int idx=0; idx < size; idx++) push(array[idx]);
+}
+
+template<class T, class KeyOf>
+void RadixHeap<T, KeyOf>::clear(){
+    if(deleteUserData != 0) deleteUserData(this);
+    for(int b=0; b < NBUCKETS; b++) buckets[b].clear();
+    count = 0;
+    last = 0;
+}
+
+template<class T, class KeyOf>
+string RadixHeap<T, KeyOf>::toString(string (*item2str)(T&)){
+    stringstream os;
+    bool first = true;
+    os << "[";
+    for(int b=0; b < NBUCKETS; b++){
+        for(Entry& entry: buckets[b]){
+            if(!first) os << ",";
+            if(item2str != 0) os << item2str(entry.item);
+            else os << entry.item;
+            first = false;
+        }
+    }
+    os << "]";
+    return os.str();
+}
+
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// (private) METHOD DEFNITION //////////////////
+//////////////////////////////////////////////////////////////////////
+
+/*
+ * refill: bucket 0 is empty: the smallest key of the first non-empty bucket
+ *  becomes "last", and that bucket is spread into the lower buckets (they all
+ *  differ from the new last below the bit of their old bucket)
+ */
+template<class T, class KeyOf>
+void RadixHeap<T, KeyOf>::refill(){
+    int b = 1;
+    while(buckets[b].empty()) b++;
+
+    vector<Entry>& bucket = buckets[b];
+    uint64_t smallest = bucket[0].key;
+    for(Entry& entry: bucket)
+        if(entry.key < smallest) smallest = entry.key;
+    last = smallest;
+    for(Entry& entry: bucket) buckets[bucketOf(entry.key)].push_back(entry);
+    bucket.clear();
+}
+
+#endif /* RADIXHEAP_H */
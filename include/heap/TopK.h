@@ -0,0 +1,131 @@
+/*
+ * File:   TopK.h
+ *
+ * TopK<T, Compare>: the k greatest items of a stream (by Compare, std::less<T> by
+ *  default: the k largest), without storing the stream
+ *  + a DaryHeap of at most k items whose top is the smallest one kept (the
+ *      threshold): an item that is not greater than it is rejected with one
+ *      comparison, O(1); otherwise it replaces the top, O(log k)
+ *  + merge(other): select from the items of another TopK (per-thread selection)
+ *  + sorted(): the items kept, greatest first
+ *  For example:
+ *      TopK<double> best(10);
+ *      for(double score: scores) best.offer(score);
+ *      vector<double> top10 = best.sorted();
+ *
+ *  T: copyable and ordered by Compare; nothing else is used (the DaryHeap is
+ *  never searched nor printed)
+ *
+ * topK(begin, end, k, nthreads, compare): the same over a random-access range, each
+ *  thread selecting from its own part, then merged; the result is sorted.
+ */
+
+#ifndef TOPK_H
+#define TOPK_H
+#include <functional>
+#include <iterator>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include "heap/DaryHeap.h"
+
+template<class T, class Compare=std::less<T> >
+class TopK{
+protected:
+    int k;
+    Compare less;
+    DaryHeap<T, 4, Compare> heap; //the items kept, the smallest on top
+
+public:
+    TopK(int k, Compare compare=Compare()): k(k), less(compare), heap(compare){
+        heap.reserve(k);
+    }
+
+    /*
+     * offer(item): keep item if it is among the k greatest so far; return true if kept
+     */
+    bool offer(T item){
+        if(heap.size() < k){
+            heap.push(item);
+            return true;
+        }
+        if(k <= 0) return false;
+        T threshold = heap.peek();
+        if(!less(threshold, item)) return false;
+        heap.replaceTop(item);
+        return true;
+    }
+    template<class InputIterator>
+    void offerAll(InputIterator begin, InputIterator end){
+        for(; begin != end; ++begin) offer(*begin);
+    }
+    /*
+     * merge(other): offer the items kept by other (other is not changed)
+     */
+    void merge(TopK<T, Compare>& other){
+        DaryHeap<T, 4, Compare> copy(other.heap);
+        while(!copy.empty()) offer(copy.pop());
+    }
+
+    /*
+     * sorted(): the items kept, greatest first (the selector is not changed)
+     * threshold(): the smallest item kept; an item must be greater to enter a
+     *  full selector
+     */
+    vector<T> sorted(){
+        DaryHeap<T, 4, Compare> copy(heap);
+        vector<T> items;
+        items.reserve(copy.size());
+        while(!copy.empty()) items.push_back(copy.pop());
+        std::reverse(items.begin(), items.end());
+        return items;
+    }
+    T threshold(){
+        return heap.peek();
+    }
+    int size(){
+        return heap.size();
+    }
+    int capacity(){
+        return k;
+    }
+    bool full(){
+        return heap.size() == k;
+    }
+    void clear(){
+        heap.clear();
+    }
+};
+
+/*
+ * topK(begin, end, k, nthreads, compare): the k greatest items of [begin, end),
+ *  greatest first; nthreads <= 0: one per hardware thread (at most one per
+ *  10^4 items)
+ */
+template<class RandomIterator, class Compare=std::less<typename iterator_traits<RandomIterator>::value_type> >
+vector<typename iterator_traits<RandomIterator>::value_type> topK(
+        RandomIterator begin, RandomIterator end, int k,
+        int nthreads=0, Compare compare=Compare()){
+    typedef typename iterator_traits<RandomIterator>::value_type T;
+    long long n = end - begin;
+    if(nthreads <= 0) nthreads = max(1u, thread::hardware_concurrency());
+    nthreads = (int)max(1LL, min((long long)nthreads, n/10000));
+
+    vector<TopK<T, Compare> > selectors(nthreads, TopK<T, Compare>(k, compare));
+    vector<thread> threads;
+    for(int t=1; t < nthreads; t++){
+        threads.push_back(thread([&, t](){
+            //selected in a local selector: no false sharing with the neighbours in selectors
+            TopK<T, Compare> local(k, compare);
+            local.offerAll(begin + n*t/nthreads, begin + n*(t + 1)/nthreads);
+            selectors[t] = local;
+        }));
+    }
+    selectors[0].offerAll(begin, begin + n/nthreads);
+    for(thread& worker: threads) worker.join();
+
+    for(int t=1; t < nthreads; t++) selectors[0].merge(selectors[t]);
+    return selectors[0].sorted();
+}
+
+#endif /* TOPK_H */
@@ -8,6 +8,8 @@
 #include <iostream>
 #include <sstream>
 #include <type_traits>
+#include <stdexcept>
+#include <utility>
 
 #include "list/IList.h"
 using namespace std;
@@ -16,6 +18,7 @@ class DLinkedList : public IList<T>
 {
 public:
     class Node;        // Forward declaration
+    class NodePool;    // Forward declaration
     class Iterator;    // Forward declaration
     class BWDIterator; // Forward declaration
 
@@ -25,18 +28,41 @@ protected:
     int count;
     bool (*itemEqual)(T& lhs, T& rhs);        // function pointer: test if two items (type: T&) are equal or not
     void (*deleteUserData)(DLinkedList<T>*); // function pointer: be called to remove items (if they are pointer type)
+    NodePool* pool;                          // optional node allocator; 0 means plain new/delete
+    Node* cursorNode;                        // last node reached by index (0: no cursor)
+    int cursorIndex;                         // index of cursorNode
 
 public:
     DLinkedList(
         void (*deleteUserData)(DLinkedList<T>*) = 0,
-        bool (*itemEqual)(T&, T&) = 0);
+        bool (*itemEqual)(T&, T&) = 0,
+        NodePool* pool = 0);
+    /*
+     * DLinkedList(first, last, ...): build a list from the items in [first, last),
+     *      e.g. DLinkedList<int> list(array, array + n);
+     */
+    template <class InputIt,
+              class = decltype(*std::declval<InputIt&>(), ++std::declval<InputIt&>(), void())>
+    DLinkedList(
+        InputIt first, InputIt last,
+        void (*deleteUserData)(DLinkedList<T>*) = 0,
+        bool (*itemEqual)(T&, T&) = 0,
+        NodePool* pool = 0) : DLinkedList(deleteUserData, itemEqual, pool)
+    {
+        for (; first != last; ++first)
+            add(*first);
+    }
     DLinkedList(const DLinkedList<T>& list);
+    DLinkedList(DLinkedList<T>&& list);
     DLinkedList<T>& operator=(const DLinkedList<T>& list);
+    DLinkedList<T>& operator=(DLinkedList<T>&& list);
     ~DLinkedList();
 
     // Inherit from IList: BEGIN
-    void add(T e);
-    void add(int index, T e);
+    void add(const T& e);
+    void add(T&& e);
+    void add(int index, const T& e);
+    void add(int index, T&& e);
     T removeAt(int index);
     bool removeItem(T item, void (*removeItemData)(T) = 0);
     bool empty();
@@ -48,6 +74,82 @@ public:
     string toString(string(*item2str)(T&) = 0);
     // Inherit from IList: END
 
+    /*
+     * emplace_back(args...), emplace(index, args...):
+     *  construct the item directly inside a new node from "args" (no temporary T),
+     *  return a reference to the stored item
+     */
+    template <class... Args>
+    T& emplace_back(Args&&... args)
+    {
+        Node* node = newNode(this->tail, this->tail->prev, std::in_place, std::forward<Args>(args)...);
+        linkAt(this->count, node);
+        return node->data;
+    }
+    template <class... Args>
+    T& emplace(int index, Args&&... args)
+    {
+        checkIndex(index);
+        Node* node = newNode(0, 0, std::in_place, std::forward<Args>(args)...);
+        linkAt(index, node);
+        return node->data;
+    }
+
+    /*
+     * Bulk operations:
+     *  splice(pos, other): move all items of "other" in front of "pos" by relinking nodes, O(1);
+     *      "other" becomes empty. If the two lists use different node pools, the items are
+     *      moved one by one instead (O(n)).
+     *  takeAll(other): splice "other" at the end of this list
+     *  append(array, n): append n items, linking the new nodes to the list in one step
+     */
+    void splice(Iterator pos, DLinkedList<T>& other);
+    void takeAll(DLinkedList<T>& other)
+    {
+        splice(end(), other);
+    }
+    void append(const T* array, int n);
+
+    /*
+     * Mutation during traversal, each O(1) per item (no re-scan from head):
+     *  erase(it): remove the item at "it", return an iterator to the following item
+     *  insert_before(it, e): insert "e" in front of "it" (it may be end()),
+     *      return an iterator to the new item
+     *  remove_if(pred): unlink all items for which pred(item) is true in one pass,
+     *      return the number of removed items
+     * Example:
+     *      for(auto it = list.begin(); it != list.end(); ){
+     *          if(*it < 0) it = list.erase(it);
+     *          else it++;
+     *      }
+     */
+    Iterator erase(Iterator pos, void (*removeItemData)(T) = 0);
+    Iterator insert_before(Iterator pos, const T& e);
+    Iterator insert_before(Iterator pos, T&& e);
+    template <class Predicate>
+    int remove_if(Predicate pred, void (*removeItemData)(T) = 0)
+    {
+        int nremoved = 0;
+        Node* current = this->head->next;
+        while (current != this->tail) {
+            Node* next = current->next;
+            if (pred(current->data)) {
+                current->prev->next = next;
+                next->prev = current->prev;
+                if (removeItemData != 0)
+                    removeItemData(current->data);
+                deleteNode(current);
+                nremoved++;
+            }
+            current = next;
+        }
+        if (nremoved > 0) {
+            this->count -= nremoved;
+            invalidateCursor();
+        }
+        return nremoved;
+    }
+
     void println(string(*item2str)(T&) = 0)
     {
         cout << toString(item2str) << endl;
@@ -56,6 +158,21 @@ public:
     {
         this->deleteUserData = deleteUserData;
     }
+    /*
+     * setNodePool(NodePool* pool): switch the node allocator of an EMPTY list
+     *  + pool == 0: nodes are allocated with new/delete (default)
+     *  + the pool is not owned by the list, it must outlive the list
+     */
+    void setNodePool(NodePool* pool)
+    {
+        if (this->count > 0)
+            throw std::logic_error("NodePool can only be changed on an empty list");
+        this->pool = pool;
+    }
+    NodePool* getNodePool()
+    {
+        return this->pool;
+    }
 
     bool contains(T array[], int size)
     {
@@ -148,6 +265,28 @@ protected:
     void removeInternalData();
     void checkIndex(int index);
     Node* getPreviousNodeOf(int index);
+    Node* getNodeAt(int index);
+    void invalidateCursor()
+    {
+        this->cursorNode = 0;
+        this->cursorIndex = -1;
+    }
+    template <class... Args>
+    Node* newNode(Node* next, Node* prev, std::in_place_t, Args&&... args)
+    {
+        if (pool != 0)
+            return pool->acquire(next, prev, std::in_place, std::forward<Args>(args)...);
+        return new Node(next, prev, std::in_place, std::forward<Args>(args)...);
+    }
+    void linkAt(int index, Node* node);
+    void releaseNodes();
+    void deleteNode(Node* node)
+    {
+        if (pool != 0)
+            pool->release(node);
+        else
+            delete node;
+    }
 
     //////////////////////////////////////////////////////////////////////
     ////////////////////////  INNER CLASSES DEFNITION ////////////////////
@@ -167,20 +306,158 @@ public:
             this->next = next;
             this->prev = prev;
         }
-        Node(T data, Node* next = 0, Node* prev = 0)
+        Node(const T& data, Node* next = 0, Node* prev = 0) : data(data)
+        {
+            this->next = next;
+            this->prev = prev;
+        }
+        Node(T&& data, Node* next = 0, Node* prev = 0) : data(std::move(data))
+        {
+            this->next = next;
+            this->prev = prev;
+        }
+        // in-place construction of data from args
+        template <class... Args>
+        Node(Node* next, Node* prev, std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...)
         {
-            this->data = data;
             this->next = next;
             this->prev = prev;
         }
     };
 
+    //////////////////////////////////////////////////////////////////////
+    /*
+     * NodePool: a slab allocator for nodes
+     *  + nodes are allocated slabSize at a time and recycled through a free-list
+     *      (linked by Node::next), so add/remove do not call new/delete per item
+     *  + a pool can be shared by many lists (e.g. all buckets of a hash table);
+     *      it must outlive every list using it
+     *  + memory of the slabs is given back to the system in the pool's destructor
+     * Example:
+     *  DLinkedList<int>::NodePool pool;
+     *  DLinkedList<int> list(0, 0, &pool);
+     */
+    class NodePool
+    {
+    private:
+        Node* freeList;  // head of recycled nodes
+        Node** slabs;    // dynamic array of allocated slabs
+        int nslabs;
+        int slabCapacity; // size of array "slabs"
+        int slabSize;     // number of nodes per slab
+        int nfree;
+
+    public:
+        NodePool(int slabSize = 64)
+        {
+            this->slabSize = slabSize > 0 ? slabSize : 64;
+            this->freeList = 0;
+            this->slabs = 0;
+            this->nslabs = this->slabCapacity = this->nfree = 0;
+        }
+        // copying a pool gives a new, empty pool: nodes are never shared between pools
+        NodePool(const NodePool& pool) : NodePool(pool.slabSize) {}
+        NodePool& operator=(const NodePool& pool)
+        {
+            return *this;
+        }
+        ~NodePool()
+        {
+            for (int idx = 0; idx < nslabs; idx++)
+                delete[] slabs[idx];
+            delete[] slabs;
+        }
+
+        template <class... Args>
+        Node* acquire(Node* next, Node* prev, std::in_place_t, Args&&... args)
+        {
+            if (freeList == 0)
+                grow();
+            Node* node = freeList;
+            freeList = freeList->next;
+            nfree--;
+            assignData(node->data, std::forward<Args>(args)...);
+            node->next = next;
+            node->prev = prev;
+            return node;
+        }
+        void release(Node* node)
+        {
+            resetData(node);
+            node->prev = 0;
+            node->next = freeList;
+            freeList = node;
+            nfree++;
+        }
+        /*
+         * releaseChain(first, last, n): give back n nodes linked by "next" from first to last.
+         *  O(1) when T is trivially destructible, otherwise each item is reset.
+         */
+        void releaseChain(Node* first, Node* last, int n)
+        {
+            if (n <= 0)
+                return;
+            if (!std::is_trivially_destructible<T>::value)
+            {
+                for (Node* node = first; node != last; node = node->next)
+                    resetData(node);
+                resetData(last);
+            }
+            last->next = freeList;
+            freeList = first;
+            nfree += n;
+        }
+        int capacity()
+        {
+            return nslabs * slabSize;
+        }
+        int available()
+        {
+            return nfree;
+        }
+
+    private:
+        void grow()
+        {
+            if (nslabs == slabCapacity)
+            {
+                int newCapacity = slabCapacity == 0 ? 4 : 2 * slabCapacity;
+                Node** newSlabs = new Node*[newCapacity];
+                for (int idx = 0; idx < nslabs; idx++)
+                    newSlabs[idx] = slabs[idx];
+                delete[] slabs;
+                slabs = newSlabs;
+                slabCapacity = newCapacity;
+            }
+            Node* slab = new Node[slabSize];
+            slabs[nslabs++] = slab;
+            for (int idx = slabSize - 1; idx >= 0; idx--)
+            {
+                slab[idx].next = freeList;
+                freeList = &slab[idx];
+            }
+            nfree += slabSize;
+        }
+        // recycled nodes already hold a T: assign instead of constructing
+        static void assignData(T& data, const T& value) { data = value; }
+        static void assignData(T& data, T&& value) { data = std::move(value); }
+        template <class... Args>
+        static void assignData(T& data, Args&&... args) { data = T(std::forward<Args>(args)...); }
+        static void resetData(Node* node)
+        {
+            // drop resources held by a recycled item (string, xarray, ...)
+            if (!std::is_trivially_destructible<T>::value)
+                node->data = T();
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////
     class Iterator
     {
     private:
         DLinkedList<T>* pList;
         Node* pNode;
+        friend class DLinkedList<T>;
 
     public:
         Iterator(DLinkedList<T>* pList = 0, bool begin = true)
@@ -215,9 +492,10 @@ public:
             Node* pNext = pNode->prev; // MUST prev, so iterator++ will go to end
             if (removeItemData != 0)
                 removeItemData(pNode->data);
-            delete pNode;
+            pList->deleteNode(pNode);
             pNode = pNext;
             pList->count -= 1;
+            pList->invalidateCursor();
         }
 
         T& operator*()
@@ -280,9 +558,10 @@ public:
             Node* pNext = pNode->next;
             if (removeItemData != 0)
                 removeItemData(pNode->data);
-            delete pNode;
+            pList->deleteNode(pNode);
             pNode = pNext;
             pList->count -= 1;
+            pList->invalidateCursor();
         }
         T& operator*()
         {
@@ -321,11 +600,14 @@ using List = DLinkedList<T>;
 template <class T>
 DLinkedList<T>::DLinkedList(
     void (*deleteUserData)(DLinkedList<T>*),
-    bool (*itemEqual)(T&, T&))
+    bool (*itemEqual)(T&, T&),
+    NodePool* pool)
 {
     // TODO
     this->deleteUserData = deleteUserData;
     this->itemEqual = itemEqual;
+    this->pool = pool;
+    this->invalidateCursor();
 
     this->head = new Node();
     this->tail = new Node();
@@ -345,17 +627,53 @@ DLinkedList<T>::DLinkedList(const DLinkedList<T>& list)
     this->tail->prev = this->head;
 
     this->count = 0;
+    this->pool = 0; // a copy never shares the pool of its source
+    this->invalidateCursor();
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
 
     int cnt = 0;
     Node *listCurrent = list.head->next;
     while(cnt < list.count){
-        this->add(cnt, listCurrent->data);
+        this->add(listCurrent->data);
         listCurrent = listCurrent->next;
         cnt++;
     }
 
 }
 
+template <class T>
+DLinkedList<T>::DLinkedList(DLinkedList<T>&& list)
+{
+    /**
+     * Move constructor: takes over all nodes of "list" (and its node pool, which owns them);
+     * "list" is left empty but usable.
+     */
+    this->head = new Node();
+    this->tail = new Node();
+    this->head->next = this->tail;
+    this->tail->prev = this->head;
+
+    this->count = 0;
+    this->pool = list.pool;
+    this->invalidateCursor();
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+
+    if (list.count > 0) {
+        this->head->next = list.head->next;
+        this->head->next->prev = this->head;
+        this->tail->prev = list.tail->prev;
+        this->tail->prev->next = this->tail;
+        this->count = list.count;
+
+        list.head->next = list.tail;
+        list.tail->prev = list.head;
+        list.count = 0;
+        list.invalidateCursor();
+    }
+}
+
 template <class T>
 DLinkedList<T>& DLinkedList<T>::operator=(const DLinkedList<T>& list)
 {
@@ -369,7 +687,7 @@ DLinkedList<T>& DLinkedList<T>::operator=(const DLinkedList<T>& list)
     int cnt = 0;
     Node *listCurrent = list.head->next;
     while(cnt < list.count){
-        this->add(cnt, listCurrent->data);
+        this->add(listCurrent->data);
         listCurrent = listCurrent->next;
         cnt++;
     }
@@ -377,6 +695,32 @@ DLinkedList<T>& DLinkedList<T>::operator=(const DLinkedList<T>& list)
 
 }
 
+template <class T>
+DLinkedList<T>& DLinkedList<T>::operator=(DLinkedList<T>&& list)
+{
+    if(this == &list){
+        return *this;
+    }
+    clear();
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+    this->pool = list.pool; // the moved nodes belong to this pool
+
+    if (list.count > 0) {
+        this->head->next = list.head->next;
+        this->head->next->prev = this->head;
+        this->tail->prev = list.tail->prev;
+        this->tail->prev->next = this->tail;
+        this->count = list.count;
+
+        list.head->next = list.tail;
+        list.tail->prev = list.head;
+        list.count = 0;
+        list.invalidateCursor();
+    }
+    return *this;
+}
+
 template <class T>
 DLinkedList<T>::~DLinkedList()
 {
@@ -403,47 +747,155 @@ void DLinkedList<T>::checkIndex(int index)
 }
 
 template <class T>
-void DLinkedList<T>::add(T e)
+void DLinkedList<T>::add(const T& e)
 {
     // TODO
-    Node *newE = new Node(e);
-    newE->prev = tail->prev;
-    newE->next = tail;
+    Node *newE = newNode(tail, tail->prev, std::in_place, e);
+    tail->prev->next = newE;
+    tail->prev = newE;
+    count++;
+}
+template <class T>
+void DLinkedList<T>::add(T&& e)
+{
+    Node *newE = newNode(tail, tail->prev, std::in_place, std::move(e));
     tail->prev->next = newE;
     tail->prev = newE;
     count++;
 }
 template <class T>
-void DLinkedList<T>::add(int index, T e)
+void DLinkedList<T>::add(int index, const T& e)
 {
     // TODO
-   checkIndex(index);
-    Node *current = this->head->next;
-    if(index == 0){
-        Node* newE = new Node(e, this->head->next, this->head);
-        this->head->next->prev = newE;
-        this->head->next = newE;
-    }
-    else if(index == this->count){
-        Node* newE = new Node(e, this->tail, this->tail->prev);
-        this->tail->prev->next = newE;
-        this->tail->prev = newE;
-    }
-    else{
-        Node *newE = new Node(e);
-        int cnt = 0;
-        while(cnt != index){
-            current = current->next;
-            cnt++;
-        }
-        newE->prev = current->prev;
-        newE->next = current;
-        current->prev->next = newE;
-        current->prev = newE;
+    checkIndex(index);
+    linkAt(index, newNode(0, 0, std::in_place, e));
+}
+template <class T>
+void DLinkedList<T>::add(int index, T&& e)
+{
+    checkIndex(index);
+    linkAt(index, newNode(0, 0, std::in_place, std::move(e)));
+}
+
+template <class T>
+void DLinkedList<T>::splice(Iterator pos, DLinkedList<T>& other)
+{
+    if (&other == this || other.count == 0)
+        return;
+    Node* current = pos.pNode; // new items go in front of this node
+
+    if (other.pool != this->pool) {
+        // nodes must go back to the pool they came from: move the items instead
+        for (Node* node = other.head->next; node != other.tail; node = node->next) {
+            Node* newE = newNode(current, current->prev, std::in_place, std::move(node->data));
+            current->prev->next = newE;
+            current->prev = newE;
+            this->count++;
+        }
+        // the items now belong to this list: other's deleteUserData must not see them
+        other.releaseNodes();
+    }
+    else {
+        Node* first = other.head->next;
+        Node* last = other.tail->prev;
+        first->prev = current->prev;
+        last->next = current;
+        current->prev->next = first;
+        current->prev = last;
+        this->count += other.count;
+
+        other.head->next = other.tail;
+        other.tail->prev = other.head;
+        other.count = 0;
+        other.invalidateCursor();
     }
+    invalidateCursor();
+}
+
+template <class T>
+typename DLinkedList<T>::Iterator DLinkedList<T>::erase(Iterator pos, void (*removeItemData)(T))
+{
+    Node* node = pos.pNode;
+    if (node == 0 || node == this->head || node == this->tail)
+        throw std::out_of_range("Iterator does not point to an item!");
+    Node* next = node->next;
+    node->prev->next = next;
+    next->prev = node->prev;
+    if (removeItemData != 0)
+        removeItemData(node->data);
+    deleteNode(node);
+    this->count--;
+    invalidateCursor();
+
+    pos.pNode = next;
+    return pos;
+}
+
+template <class T>
+typename DLinkedList<T>::Iterator DLinkedList<T>::insert_before(Iterator pos, const T& e)
+{
+    T item(e); // e may be an item of this list
+    return insert_before(pos, std::move(item));
+}
+
+template <class T>
+typename DLinkedList<T>::Iterator DLinkedList<T>::insert_before(Iterator pos, T&& e)
+{
+    Node* current = pos.pNode;
+    if (current == 0 || current == this->head)
+        throw std::out_of_range("Iterator does not point to an item!");
+    Node* newE = newNode(current, current->prev, std::in_place, std::move(e));
+    current->prev->next = newE;
+    current->prev = newE;
     this->count++;
+    invalidateCursor();
+
+    pos.pNode = newE;
+    return pos;
+}
+
+template <class T>
+void DLinkedList<T>::append(const T* array, int n)
+{
+    if (array == 0 || n <= 0)
+        return;
+    // build the chain first, then attach it before tail
+    Node* first = newNode(0, 0, std::in_place, array[0]);
+    Node* last = first;
+    for (int idx = 1; idx < n; idx++) {
+        Node* newE = newNode(0, last, std::in_place, array[idx]);
+        last->next = newE;
+        last = newE;
+    }
+    first->prev = tail->prev;
+    last->next = tail;
+    tail->prev->next = first;
+    tail->prev = last;
+    this->count += n;
+}
+
+template <class T>
+void DLinkedList<T>::linkAt(int index, Node* newE)
+{
+    /**
+     * Links an already allocated node so that it ends up at "index" (0 <= index <= count).
+     */
+    Node *current;
+    if(index == 0)
+        current = this->head->next;
+    else if(index == this->count)
+        current = this->tail;
+    else
+        current = getNodeAt(index);
 
-    current = nullptr;
+    newE->prev = current->prev;
+    newE->next = current;
+    current->prev->next = newE;
+    current->prev = newE;
+    this->count++;
+    // items at/after "index" moved one step to the right
+    if (cursorNode != 0 && index <= cursorIndex)
+        cursorIndex++;
 }
 
 template <class T>
@@ -455,12 +907,40 @@ typename DLinkedList<T>::Node* DLinkedList<T>::getPreviousNodeOf(int index)
      * Efficiently navigates to the node by choosing the shorter path based on the index's position.
      */
      // TODO    
-    Node *current = this->head;
-    for(int i = 0; i < index; i++){
-        current = current->next;
+    if (index == 0)
+        return this->head;
+    return getNodeAt(index - 1);
+}
+
+template <class T>
+typename DLinkedList<T>::Node* DLinkedList<T>::getNodeAt(int index)
+{
+    /**
+     * Returns the node at "index" (0 <= index < count), starting the walk from
+     * head, tail or the cached cursor, whichever is closest.
+     * The reached node becomes the new cursor, so get(i) followed by get(i +/- 1) is O(1).
+     */
+    Node *current;
+    int fromHead = index;
+    int fromTail = this->count - 1 - index;
+    int fromCursor = cursorNode != 0 ? (index > cursorIndex ? index - cursorIndex : cursorIndex - index) : this->count;
+
+    if (fromCursor <= fromHead && fromCursor <= fromTail) {
+        current = cursorNode;
+        for (int i = cursorIndex; i < index; i++) current = current->next;
+        for (int i = cursorIndex; i > index; i--) current = current->prev;
     }
+    else if (fromHead <= fromTail) {
+        current = this->head->next;
+        for (int i = 0; i < index; i++) current = current->next;
+    }
+    else {
+        current = this->tail->prev;
+        for (int i = this->count - 1; i > index; i--) current = current->prev;
+    }
+    cursorNode = current;
+    cursorIndex = index;
     return current;
-
 }
 
 template <class T>
@@ -471,7 +951,6 @@ T DLinkedList<T>::removeAt(int index)
         throw std::out_of_range("Index is out of range!");
     }
   Node *nodeToRemove;
-    T removedValue;
 
     
     if (index == 0) {
@@ -494,9 +973,13 @@ T DLinkedList<T>::removeAt(int index)
         prevNode->next = nodeToRemove->next;
         nodeToRemove->next->prev = prevNode;
     }
-    removedValue = nodeToRemove->data;
-    delete nodeToRemove;
+    T removedValue = std::move(nodeToRemove->data);
+    deleteNode(nodeToRemove);
     this->count--;
+    if (cursorNode != 0) {
+        if (index == cursorIndex) invalidateCursor();
+        else if (index < cursorIndex) cursorIndex--;
+    }
 
     return removedValue;
 }
@@ -522,17 +1005,33 @@ void DLinkedList<T>::clear()
     if (deleteUserData) {
         deleteUserData(this);
     }
+    releaseNodes();
+}
 
+template <class T>
+void DLinkedList<T>::releaseNodes()
+{
+    /**
+     * Frees (or gives back to the pool) every node and empties the list, without
+     * calling deleteUserData on the items.
+     */
+    if (pool != 0) {
+        // bulk release: hand the whole chain back to the pool
+        pool->releaseChain(this->head->next, this->tail->prev, this->count);
+    }
+    else {
         Node* current = this->head->next;
         while (current != tail) {
             Node* next = current->next;
             delete current;
             current = next;
         }
+    }
 
     this->head->next = tail;
     this->tail->prev = head;
     this->count = 0;
+    invalidateCursor();
 }
 
 template <class T>
@@ -542,14 +1041,7 @@ T& DLinkedList<T>::get(int index)
     if (index < 0 || index > this->count - 1) {
         throw std::out_of_range("Index is out of range!");
     }
-     Node *current = this->head;
-    for (int i = 0; i <= index; i++) {
-        current = current->next;
-    }
-    
-    return current->data;
-
-
+    return getNodeAt(index)->data;
 }
 
 template <class T>
@@ -583,10 +1075,11 @@ bool DLinkedList<T>::removeItem(T item, void (*removeItemData)(T))
                 current->prev->next = current->next;
                 current->next->prev = current->prev;
                 this->count--;
+                invalidateCursor();
                 if(removeItemData != nullptr){
                     removeItemData(current->data);
                 }
-                delete current;
+                deleteNode(current);
                 return true;
             }
             else{ 
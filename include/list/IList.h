@@ -22,15 +22,18 @@ class IList{
 public:
     virtual ~IList(){};
     /* add(T e): append item "e" to the list
+     *      the T&& overload moves "e" into the list instead of copying it
      */
-    virtual void    add(T e)=0;
+    virtual void    add(const T& e)=0;
+    virtual void    add(T&& e)=0;
     
     
     
     /* add(int index, T e): insert item "e" at location "index";
      *      location is an integer started from 0
      */
-    virtual void    add(int index, T e)=0;
+    virtual void    add(int index, const T& e)=0;
+    virtual void    add(int index, T&& e)=0;
     
     
     
@@ -0,0 +1,481 @@
+/*
+ * File:   IntrusiveList.h
+ */
+
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+using namespace std;
+
+/*
+ * IntrusiveListHook<Tag>:
+ *  + the links (next, prev) of an intrusive list, embedded in the user's type:
+ *      class VertexNode : public IntrusiveListHook<> { ... };
+ *  + Tag: only needed when an object must be in several lists at the same time,
+ *      one hook (base class) per list, e.g. IntrusiveListHook<ByName>, IntrusiveListHook<ByAge>
+ *  + copying an object never copies its links: the copy starts unlinked
+ */
+template <class Tag = void>
+class IntrusiveListHook
+{
+private:
+    IntrusiveListHook* next;
+    IntrusiveListHook* prev;
+    template <class T, class Tag2>
+    friend class IntrusiveList;
+
+public:
+    IntrusiveListHook() : next(0), prev(0) {}
+    IntrusiveListHook(const IntrusiveListHook&) : next(0), prev(0) {}
+    IntrusiveListHook& operator=(const IntrusiveListHook&)
+    {
+        return *this;
+    }
+    bool linked() const
+    {
+        return next != 0;
+    }
+};
+
+/*
+ * IntrusiveList<T, Tag>:
+ *  + a doubly-linked list of T* where the links live inside T (see IntrusiveListHook),
+ *      so add/remove never allocate and a traversal touches only the items themselves
+ *  + the list does not own the items: removing an item only unlinks it
+ *      (pass "free" to the constructor to delete the remaining items in clear/destructor)
+ *  + an item can be in at most one list per Tag at a time
+ *  + the vocabulary follows DLinkedList<T*>: add, removeAt, removeItem, get, indexOf,
+ *      begin/end (Iterator), bbegin/bend (BWDIterator), Iterator::remove
+ */
+template <class T, class Tag = void>
+class IntrusiveList
+{
+public:
+    typedef IntrusiveListHook<Tag> Hook;
+    class Iterator;    // Forward declaration
+    class BWDIterator; // Forward declaration
+
+protected:
+    Hook head; // sentinel: head.next is the first item, head.prev is the last one
+    int count;
+    void (*deleteUserData)(IntrusiveList<T, Tag>*);
+
+public:
+    IntrusiveList(void (*deleteUserData)(IntrusiveList<T, Tag>*) = 0);
+    IntrusiveList(IntrusiveList<T, Tag>&& list);
+    IntrusiveList<T, Tag>& operator=(IntrusiveList<T, Tag>&& list);
+    // an item cannot be linked into two lists through one hook: no copy
+    IntrusiveList(const IntrusiveList<T, Tag>& list) = delete;
+    IntrusiveList<T, Tag>& operator=(const IntrusiveList<T, Tag>& list) = delete;
+    ~IntrusiveList();
+
+    void add(T* item);
+    void add(int index, T* item);
+    T* removeAt(int index);
+    /*
+     * removeItem(item, removeItemData): O(1), "item" must be linked into this list
+     *  (or not linked at all, then false is returned)
+     */
+    bool removeItem(T* item, void (*removeItemData)(T*) = 0);
+    bool empty();
+    int size();
+    void clear();
+    T* get(int index);
+    int indexOf(T* item);
+    bool contains(T* item);
+    string toString(string (*item2str)(T*) = 0);
+
+    T* front();
+    T* back();
+
+    void println(string (*item2str)(T*) = 0)
+    {
+        cout << toString(item2str) << endl;
+    }
+
+    /*
+     * free(IntrusiveList<T, Tag> *list):
+     *  + to delete the items (allocated with new) still linked into the list
+     *  + Example:
+     *      IntrusiveList<Entry> list(&IntrusiveList<Entry>::free);
+     */
+    static void free(IntrusiveList<T, Tag>* list)
+    {
+        while (list->count > 0)
+            delete list->removeAt(0);
+    }
+
+    /* begin, end and Iterator helps user to traverse a list forwardly
+     * Example: assume "list" is object of IntrusiveList<VertexNode>
+
+     for(IntrusiveList<VertexNode>::Iterator it = list.begin(); it != list.end(); it++){
+            VertexNode* node = *it;
+     }
+     */
+    Iterator begin()
+    {
+        return Iterator(this, true);
+    }
+    Iterator end()
+    {
+        return Iterator(this, false);
+    }
+    Iterator begin() const
+    {
+        return Iterator(const_cast<IntrusiveList<T, Tag>*>(this), true);
+    }
+    Iterator end() const
+    {
+        return Iterator(const_cast<IntrusiveList<T, Tag>*>(this), false);
+    }
+    BWDIterator bbegin()
+    {
+        return BWDIterator(this, true);
+    }
+    BWDIterator bend()
+    {
+        return BWDIterator(this, false);
+    }
+
+protected:
+    static T* item(Hook* hook)
+    {
+        return static_cast<T*>(hook);
+    }
+    static Hook* hook(T* item)
+    {
+        return static_cast<Hook*>(item);
+    }
+    void checkIndex(int index)
+    {
+        if (!(index >= 0 && index <= count))
+            throw std::out_of_range("Index is out of range!");
+    }
+    Hook* getHookAt(int index);
+    void linkBefore(Hook* pos, Hook* node)
+    {
+        node->next = pos;
+        node->prev = pos->prev;
+        pos->prev->next = node;
+        pos->prev = node;
+        count++;
+    }
+    void unlink(Hook* node)
+    {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        node->next = node->prev = 0;
+        count--;
+    }
+    void takeLinks(IntrusiveList<T, Tag>& list);
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+public:
+    class Iterator
+    {
+    private:
+        IntrusiveList<T, Tag>* pList;
+        Hook* pNode;
+        friend class IntrusiveList<T, Tag>;
+
+    public:
+        Iterator(IntrusiveList<T, Tag>* pList = 0, bool begin = true)
+        {
+            if (pList != 0)
+                this->pNode = begin ? pList->head.next : &pList->head;
+            else
+                this->pNode = 0;
+            this->pList = pList;
+        }
+        /*
+         * remove(removeItemData): unlink the current item, then call removeItemData on it;
+         *  the iterator steps back, so iterator++ goes to the item after the removed one
+         */
+        void remove(void (*removeItemData)(T*) = 0)
+        {
+            Hook* pPrev = pNode->prev;
+            T* pItem = item(pNode);
+            pList->unlink(pNode);
+            pNode = pPrev;
+            if (removeItemData != 0)
+                removeItemData(pItem);
+        }
+
+        T* operator*()
+        {
+            return item(pNode);
+        }
+        bool operator!=(const Iterator& iterator)
+        {
+            return pNode != iterator.pNode;
+        }
+        // Prefix ++ overload
+        Iterator& operator++()
+        {
+            pNode = pNode->next;
+            return *this;
+        }
+        // Postfix ++ overload
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++*this;
+            return iterator;
+        }
+    };
+
+    class BWDIterator
+    {
+    private:
+        IntrusiveList<T, Tag>* pList;
+        Hook* pNode;
+
+    public:
+        BWDIterator(IntrusiveList<T, Tag>* pList = 0, bool bbegin = true)
+        {
+            if (pList != 0)
+                this->pNode = bbegin ? pList->head.prev : &pList->head;
+            else
+                this->pNode = 0;
+            this->pList = pList;
+        }
+        void remove(void (*removeItemData)(T*) = 0)
+        {
+            Hook* pNext = pNode->next;
+            T* pItem = item(pNode);
+            pList->unlink(pNode);
+            pNode = pNext;
+            if (removeItemData != 0)
+                removeItemData(pItem);
+        }
+
+        T* operator*()
+        {
+            return item(pNode);
+        }
+        bool operator!=(const BWDIterator& iterator)
+        {
+            return pNode != iterator.pNode;
+        }
+        // Prefix -- overload
+        BWDIterator& operator--()
+        {
+            pNode = pNode->prev;
+            return *this;
+        }
+        // Postfix -- overload
+        BWDIterator operator--(int)
+        {
+            BWDIterator iterator = *this;
+            --*this;
+            return iterator;
+        }
+    };
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class T, class Tag>
+IntrusiveList<T, Tag>::IntrusiveList(void (*deleteUserData)(IntrusiveList<T, Tag>*))
+{
+    this->head.next = this->head.prev = &this->head;
+    this->count = 0;
+    this->deleteUserData = deleteUserData;
+}
+
+template <class T, class Tag>
+IntrusiveList<T, Tag>::IntrusiveList(IntrusiveList<T, Tag>&& list)
+{
+    this->head.next = this->head.prev = &this->head;
+    this->count = 0;
+    this->deleteUserData = list.deleteUserData;
+    takeLinks(list);
+}
+
+template <class T, class Tag>
+IntrusiveList<T, Tag>& IntrusiveList<T, Tag>::operator=(IntrusiveList<T, Tag>&& list)
+{
+    if (this == &list)
+        return *this;
+    clear();
+    this->deleteUserData = list.deleteUserData;
+    takeLinks(list);
+    return *this;
+}
+
+template <class T, class Tag>
+IntrusiveList<T, Tag>::~IntrusiveList()
+{
+    clear();
+}
+
+/*
+ * takeLinks(list): relink all items of "list" (must be non-aliased) into this empty list
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::takeLinks(IntrusiveList<T, Tag>& list)
+{
+    if (list.count == 0)
+        return;
+    this->head.next = list.head.next;
+    this->head.prev = list.head.prev;
+    this->head.next->prev = &this->head;
+    this->head.prev->next = &this->head;
+    this->count = list.count;
+
+    list.head.next = list.head.prev = &list.head;
+    list.count = 0;
+}
+
+template <class T, class Tag>
+typename IntrusiveList<T, Tag>::Hook* IntrusiveList<T, Tag>::getHookAt(int index)
+{
+    // index == count gives the sentinel (insert position at the end)
+    Hook* node;
+    if (index <= count / 2)
+    {
+        node = head.next;
+        for (int idx = 0; idx < index; idx++)
+            node = node->next;
+    }
+    else
+    {
+        node = &head;
+        for (int idx = count; idx > index; idx--)
+            node = node->prev;
+    }
+    return node;
+}
+
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::add(T* item)
+{
+    linkBefore(&head, hook(item));
+}
+
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::add(int index, T* item)
+{
+    checkIndex(index);
+    linkBefore(getHookAt(index), hook(item));
+}
+
+template <class T, class Tag>
+T* IntrusiveList<T, Tag>::removeAt(int index)
+{
+    if (!(index >= 0 && index < count))
+        throw std::out_of_range("Index is out of range!");
+    Hook* node = getHookAt(index);
+    unlink(node);
+    return item(node);
+}
+
+template <class T, class Tag>
+bool IntrusiveList<T, Tag>::removeItem(T* pItem, void (*removeItemData)(T*))
+{
+    if (pItem == 0 || !hook(pItem)->linked())
+        return false;
+    unlink(hook(pItem));
+    if (removeItemData != 0)
+        removeItemData(pItem);
+    return true;
+}
+
+template <class T, class Tag>
+bool IntrusiveList<T, Tag>::empty()
+{
+    return count == 0;
+}
+
+template <class T, class Tag>
+int IntrusiveList<T, Tag>::size()
+{
+    return count;
+}
+
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::clear()
+{
+    if (deleteUserData != 0)
+        deleteUserData(this);
+    // unlink the rest, so the items can join another list later
+    Hook* node = head.next;
+    while (node != &head)
+    {
+        Hook* next = node->next;
+        node->next = node->prev = 0;
+        node = next;
+    }
+    head.next = head.prev = &head;
+    count = 0;
+}
+
+template <class T, class Tag>
+T* IntrusiveList<T, Tag>::get(int index)
+{
+    if (!(index >= 0 && index < count))
+        throw std::out_of_range("Index is out of range!");
+    return item(getHookAt(index));
+}
+
+template <class T, class Tag>
+int IntrusiveList<T, Tag>::indexOf(T* pItem)
+{
+    int index = 0;
+    for (Hook* node = head.next; node != &head; node = node->next, index++)
+    {
+        if (item(node) == pItem)
+            return index;
+    }
+    return -1;
+}
+
+template <class T, class Tag>
+bool IntrusiveList<T, Tag>::contains(T* pItem)
+{
+    return indexOf(pItem) != -1;
+}
+
+template <class T, class Tag>
+T* IntrusiveList<T, Tag>::front()
+{
+    if (count == 0)
+        throw std::out_of_range("Index is out of range!");
+    return item(head.next);
+}
+
+template <class T, class Tag>
+T* IntrusiveList<T, Tag>::back()
+{
+    if (count == 0)
+        throw std::out_of_range("Index is out of range!");
+    return item(head.prev);
+}
+
+template <class T, class Tag>
+string IntrusiveList<T, Tag>::toString(string (*item2str)(T*))
+{
+    stringstream os;
+    os << "[";
+    for (Hook* node = head.next; node != &head; node = node->next)
+    {
+        if (item2str != 0)
+            os << item2str(item(node));
+        else
+            os << item(node);
+        if (node->next != &head)
+            os << ", ";
+    }
+    os << "]";
+    return os.str();
+}
+
+#endif /* INTRUSIVELIST_H */
@@ -0,0 +1,727 @@
+/*
+ * File:   UnrolledLinkedList.h
+ */
+
+#ifndef UNROLLEDLINKEDLIST_H
+#define UNROLLEDLINKEDLIST_H
+
+#include <iostream>
+#include <sstream>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "list/IList.h"
+using namespace std;
+
+/*
+ * UnrolledLinkedList<T, CHUNK>: a doubly linked list of chunks, each chunk holding
+ *      up to CHUNK items in a small array.
+ *  + traversal, indexOf and removeItem touch one node per CHUNK items
+ *  + add(index, e) only shifts items inside one chunk; a full chunk is split in two
+ *  + removing items merges a chunk with its successor when both fit in one chunk,
+ *      and frees chunks that become empty
+ *  + Iterator/BWDIterator have the same API as DLinkedList's ones, so
+ *      UnrolledLinkedList<T> can replace DLinkedList<T> in traversal code
+ */
+template <class T, int CHUNK = 16>
+class UnrolledLinkedList : public IList<T>
+{
+public:
+    class Chunk;       // Forward declaration
+    class Iterator;    // Forward declaration
+    class BWDIterator; // Forward declaration
+
+protected:
+    Chunk* head; // this chunk does not contain user's data
+    Chunk* tail; // this chunk does not contain user's data
+    int count;
+    bool (*itemEqual)(T& lhs, T& rhs);                     // function pointer: test if two items (type: T&) are equal or not
+    void (*deleteUserData)(UnrolledLinkedList<T, CHUNK>*); // function pointer: be called to remove items (if they are pointer type)
+
+public:
+    UnrolledLinkedList(
+        void (*deleteUserData)(UnrolledLinkedList<T, CHUNK>*) = 0,
+        bool (*itemEqual)(T&, T&) = 0);
+    UnrolledLinkedList(const UnrolledLinkedList<T, CHUNK>& list);
+    UnrolledLinkedList(UnrolledLinkedList<T, CHUNK>&& list);
+    UnrolledLinkedList<T, CHUNK>& operator=(const UnrolledLinkedList<T, CHUNK>& list);
+    UnrolledLinkedList<T, CHUNK>& operator=(UnrolledLinkedList<T, CHUNK>&& list);
+    ~UnrolledLinkedList();
+
+    // Inherit from IList: BEGIN
+    void add(const T& e);
+    void add(T&& e);
+    void add(int index, const T& e);
+    void add(int index, T&& e);
+    T removeAt(int index);
+    bool removeItem(T item, void (*removeItemData)(T) = 0);
+    bool empty();
+    int size();
+    void clear();
+    T& get(int index);
+    int indexOf(T item);
+    bool contains(T item);
+    string toString(string (*item2str)(T&) = 0);
+    // Inherit from IList: END
+
+    void println(string (*item2str)(T&) = 0)
+    {
+        cout << toString(item2str) << endl;
+    }
+    void setDeleteUserDataPtr(void (*deleteUserData)(UnrolledLinkedList<T, CHUNK>*) = 0)
+    {
+        this->deleteUserData = deleteUserData;
+    }
+    /* number of chunks currently allocated (sentinels excluded) */
+    int chunkCount()
+    {
+        int n = 0;
+        for (Chunk* chunk = head->next; chunk != tail; chunk = chunk->next)
+            n++;
+        return n;
+    }
+
+    /*
+     * free(UnrolledLinkedList<T> *list): delete user's data (T must be a pointer type)
+     *  Example:
+     *      UnrolledLinkedList<Point*> list(&UnrolledLinkedList<Point*>::free);
+     */
+    static void free(UnrolledLinkedList<T, CHUNK>* list)
+    {
+        for (Iterator it = list->begin(); it != list->end(); it++)
+            delete *it;
+    }
+
+    /* begin, end: traverse the list forwardly, same as DLinkedList */
+    Iterator begin()
+    {
+        return Iterator(this, true);
+    }
+    Iterator end()
+    {
+        return Iterator(this, false);
+    }
+    Iterator begin() const
+    {
+        return Iterator(const_cast<UnrolledLinkedList<T, CHUNK>*>(this), true);
+    }
+    Iterator end() const
+    {
+        return Iterator(const_cast<UnrolledLinkedList<T, CHUNK>*>(this), false);
+    }
+
+    /* bbegin, bend: traverse the list backwardly, same as DLinkedList */
+    BWDIterator bbegin()
+    {
+        return BWDIterator(this, true);
+    }
+    BWDIterator bend()
+    {
+        return BWDIterator(this, false);
+    }
+
+protected:
+    static bool equals(T& lhs, T& rhs, bool (*itemEqual)(T&, T&))
+    {
+        if (itemEqual == 0)
+            return lhs == rhs;
+        else
+            return itemEqual(lhs, rhs);
+    }
+    void checkIndex(int index);
+    void init();
+    void stealFrom(UnrolledLinkedList<T, CHUNK>& list);
+    Chunk* newChunkAfter(Chunk* chunk);
+    void deleteChunk(Chunk* chunk);
+    Chunk* locate(int index, int& offset);
+    void insertAt(int index, T&& item);
+    void insertIn(Chunk* chunk, int offset, T&& item);
+    void split(Chunk* chunk);
+    T eraseAt(Chunk* chunk, int offset);
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+public:
+    class Chunk
+    {
+    public:
+        int n; // number of items in this chunk
+        Chunk* next;
+        Chunk* prev;
+        alignas(T) unsigned char storage[sizeof(T) * CHUNK]; // items[0 .. n-1] are constructed
+
+    public:
+        Chunk(Chunk* next = 0, Chunk* prev = 0)
+        {
+            this->n = 0;
+            this->next = next;
+            this->prev = prev;
+        }
+        T* items()
+        {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////
+    class Iterator
+    {
+    private:
+        UnrolledLinkedList<T, CHUNK>* pList;
+        Chunk* pChunk;
+        int offset;
+
+    public:
+        Iterator(UnrolledLinkedList<T, CHUNK>* pList = 0, bool begin = true)
+        {
+            this->pList = pList;
+            this->offset = 0;
+            if (pList == 0)
+                pChunk = 0;
+            else if (begin)
+                pChunk = pList->head->next; // == tail when the list is empty
+            else
+                pChunk = pList->tail;
+        }
+        Iterator& operator=(const Iterator& iterator)
+        {
+            this->pList = iterator.pList;
+            this->pChunk = iterator.pChunk;
+            this->offset = iterator.offset;
+            return *this;
+        }
+        /*
+         * remove(): remove the current item;
+         *  the iterator goes back to the previous item, so iterator++ reaches the next one
+         */
+        void remove(void (*removeItemData)(T) = 0)
+        {
+            Chunk* prevChunk = pChunk;
+            int prevOffset = offset - 1;
+            if (offset == 0)
+            {
+                prevChunk = pChunk->prev;
+                prevOffset = prevChunk->n - 1; // -1 for head
+            }
+            T item = pList->eraseAt(pChunk, offset);
+            if (removeItemData != 0)
+                removeItemData(item);
+            pChunk = prevChunk;
+            offset = prevOffset;
+        }
+
+        T& operator*()
+        {
+            return pChunk->items()[offset];
+        }
+        bool operator!=(const Iterator& iterator)
+        {
+            return pChunk != iterator.pChunk || offset != iterator.offset;
+        }
+        // Prefix ++ overload
+        Iterator& operator++()
+        {
+            offset++;
+            if (offset >= pChunk->n)
+            {
+                pChunk = pChunk->next;
+                offset = 0;
+            }
+            return *this;
+        }
+        // Postfix ++ overload
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++*this;
+            return iterator;
+        }
+    };
+
+    class BWDIterator
+    {
+    private:
+        UnrolledLinkedList<T, CHUNK>* pList;
+        Chunk* pChunk;
+        int offset;
+
+    public:
+        BWDIterator(UnrolledLinkedList<T, CHUNK>* pList = 0, bool bbegin = true)
+        {
+            this->pList = pList;
+            if (pList == 0)
+            {
+                pChunk = 0;
+                offset = 0;
+            }
+            else if (bbegin)
+            {
+                pChunk = pList->tail->prev; // == head when the list is empty
+                offset = pChunk->n - 1;
+            }
+            else
+            {
+                pChunk = pList->head;
+                offset = -1;
+            }
+        }
+        BWDIterator& operator=(const BWDIterator& BWDiterator)
+        {
+            this->pList = BWDiterator.pList;
+            this->pChunk = BWDiterator.pChunk;
+            this->offset = BWDiterator.offset;
+            return *this;
+        }
+        /*
+         * remove(): remove the current item;
+         *  the iterator goes to the next item, so iterator-- reaches the previous one
+         */
+        void remove(void (*removeItemData)(T) = 0)
+        {
+            Chunk* nextChunk = pChunk->next;
+            bool emptied = pChunk->n == 1;
+            T item = pList->eraseAt(pChunk, offset);
+            if (removeItemData != 0)
+                removeItemData(item);
+            if (emptied || offset >= pChunk->n)
+            {
+                pChunk = emptied ? nextChunk : pChunk->next;
+                offset = 0;
+            }
+        }
+        T& operator*()
+        {
+            return pChunk->items()[offset];
+        }
+        bool operator!=(const BWDIterator& BWDiterator)
+        {
+            return pChunk != BWDiterator.pChunk || offset != BWDiterator.offset;
+        }
+        // Prefix -- overload
+        BWDIterator& operator--()
+        {
+            offset--;
+            if (offset < 0 && pChunk->prev != 0)
+            {
+                pChunk = pChunk->prev;
+                offset = pChunk->n - 1;
+            }
+            return *this;
+        }
+        // Postfix -- overload
+        BWDIterator operator--(int)
+        {
+            BWDIterator BWDiterator = *this;
+            --(*this);
+            return BWDiterator;
+        }
+    };
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class T, int CHUNK>
+UnrolledLinkedList<T, CHUNK>::UnrolledLinkedList(
+    void (*deleteUserData)(UnrolledLinkedList<T, CHUNK>*),
+    bool (*itemEqual)(T&, T&))
+{
+    this->deleteUserData = deleteUserData;
+    this->itemEqual = itemEqual;
+    init();
+}
+
+template <class T, int CHUNK>
+UnrolledLinkedList<T, CHUNK>::UnrolledLinkedList(const UnrolledLinkedList<T, CHUNK>& list)
+{
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+    init();
+    for (Iterator it = list.begin(); it != list.end(); it++)
+        this->add(*it);
+}
+
+template <class T, int CHUNK>
+UnrolledLinkedList<T, CHUNK>::UnrolledLinkedList(UnrolledLinkedList<T, CHUNK>&& list)
+{
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+    init();
+    stealFrom(list);
+}
+
+template <class T, int CHUNK>
+UnrolledLinkedList<T, CHUNK>& UnrolledLinkedList<T, CHUNK>::operator=(const UnrolledLinkedList<T, CHUNK>& list)
+{
+    if (this == &list)
+        return *this;
+    clear();
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+    for (Iterator it = list.begin(); it != list.end(); it++)
+        this->add(*it);
+    return *this;
+}
+
+template <class T, int CHUNK>
+UnrolledLinkedList<T, CHUNK>& UnrolledLinkedList<T, CHUNK>::operator=(UnrolledLinkedList<T, CHUNK>&& list)
+{
+    if (this == &list)
+        return *this;
+    clear();
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+    stealFrom(list);
+    return *this;
+}
+
+template <class T, int CHUNK>
+UnrolledLinkedList<T, CHUNK>::~UnrolledLinkedList()
+{
+    this->clear();
+    delete head;
+    delete tail;
+}
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::add(const T& e)
+{
+    T item(e);
+    insertAt(count, std::move(item));
+}
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::add(T&& e)
+{
+    insertAt(count, std::move(e));
+}
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::add(int index, const T& e)
+{
+    checkIndex(index);
+    T item(e);
+    insertAt(index, std::move(item));
+}
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::add(int index, T&& e)
+{
+    checkIndex(index);
+    insertAt(index, std::move(e));
+}
+
+template <class T, int CHUNK>
+T UnrolledLinkedList<T, CHUNK>::removeAt(int index)
+{
+    if (index < 0 || index >= count)
+        throw std::out_of_range("Index is out of range!");
+    int offset;
+    Chunk* chunk = locate(index, offset);
+    return eraseAt(chunk, offset);
+}
+
+template <class T, int CHUNK>
+bool UnrolledLinkedList<T, CHUNK>::removeItem(T item, void (*removeItemData)(T))
+{
+    for (Chunk* chunk = head->next; chunk != tail; chunk = chunk->next)
+    {
+        T* items = chunk->items();
+        for (int idx = 0; idx < chunk->n; idx++)
+        {
+            if (equals(items[idx], item, this->itemEqual))
+            {
+                if (removeItemData != 0)
+                    removeItemData(items[idx]);
+                eraseAt(chunk, idx);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template <class T, int CHUNK>
+bool UnrolledLinkedList<T, CHUNK>::empty()
+{
+    return count == 0;
+}
+
+template <class T, int CHUNK>
+int UnrolledLinkedList<T, CHUNK>::size()
+{
+    return count;
+}
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::clear()
+{
+    if (deleteUserData != 0)
+        deleteUserData(this);
+
+    Chunk* chunk = head->next;
+    while (chunk != tail)
+    {
+        Chunk* next = chunk->next;
+        T* items = chunk->items();
+        for (int idx = 0; idx < chunk->n; idx++)
+            items[idx].~T();
+        delete chunk;
+        chunk = next;
+    }
+    head->next = tail;
+    tail->prev = head;
+    count = 0;
+}
+
+template <class T, int CHUNK>
+T& UnrolledLinkedList<T, CHUNK>::get(int index)
+{
+    if (index < 0 || index >= count)
+        throw std::out_of_range("Index is out of range!");
+    int offset;
+    Chunk* chunk = locate(index, offset);
+    return chunk->items()[offset];
+}
+
+template <class T, int CHUNK>
+int UnrolledLinkedList<T, CHUNK>::indexOf(T item)
+{
+    int base = 0;
+    for (Chunk* chunk = head->next; chunk != tail; chunk = chunk->next)
+    {
+        T* items = chunk->items();
+        for (int idx = 0; idx < chunk->n; idx++)
+        {
+            if (equals(items[idx], item, this->itemEqual))
+                return base + idx;
+        }
+        base += chunk->n;
+    }
+    return -1;
+}
+
+template <class T, int CHUNK>
+bool UnrolledLinkedList<T, CHUNK>::contains(T item)
+{
+    return indexOf(item) != -1;
+}
+
+template <class T, int CHUNK>
+string UnrolledLinkedList<T, CHUNK>::toString(string (*item2str)(T&))
+{
+    stringstream os;
+    os << "[";
+    bool first = true;
+    for (Iterator it = begin(); it != end(); ++it)
+    {
+        if (!first)
+            os << ", ";
+        if (item2str != 0)
+            os << item2str(*it);
+        else
+            os << *it;
+        first = false;
+    }
+    os << "]";
+    return os.str();
+}
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// (protected) METHOD DEFNITION ////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::checkIndex(int index)
+{
+    if (index < 0 || index > count)
+        throw std::out_of_range("Index is out of range!");
+}
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::init()
+{
+    head = new Chunk();
+    tail = new Chunk();
+    head->next = tail;
+    tail->prev = head;
+    count = 0;
+}
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::stealFrom(UnrolledLinkedList<T, CHUNK>& list)
+{
+    /**
+     * Relinks all chunks of "list" into this (empty) list; "list" becomes empty.
+     */
+    if (list.count == 0)
+        return;
+    head->next = list.head->next;
+    head->next->prev = head;
+    tail->prev = list.tail->prev;
+    tail->prev->next = tail;
+    count = list.count;
+
+    list.head->next = list.tail;
+    list.tail->prev = list.head;
+    list.count = 0;
+}
+
+template <class T, int CHUNK>
+typename UnrolledLinkedList<T, CHUNK>::Chunk* UnrolledLinkedList<T, CHUNK>::newChunkAfter(Chunk* chunk)
+{
+    Chunk* newChunk = new Chunk(chunk->next, chunk);
+    chunk->next->prev = newChunk;
+    chunk->next = newChunk;
+    return newChunk;
+}
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::deleteChunk(Chunk* chunk)
+{
+    // chunk must be empty
+    chunk->prev->next = chunk->next;
+    chunk->next->prev = chunk->prev;
+    delete chunk;
+}
+
+template <class T, int CHUNK>
+typename UnrolledLinkedList<T, CHUNK>::Chunk* UnrolledLinkedList<T, CHUNK>::locate(int index, int& offset)
+{
+    /**
+     * Finds the chunk holding item "index" (0 <= index < count) and its offset in that chunk,
+     * walking from head or tail, whichever is closer.
+     */
+    if (index < count / 2)
+    {
+        Chunk* chunk = head->next;
+        while (index >= chunk->n)
+        {
+            index -= chunk->n;
+            chunk = chunk->next;
+        }
+        offset = index;
+        return chunk;
+    }
+    int fromTail = count - 1 - index; // items after "index"
+    Chunk* chunk = tail->prev;
+    while (fromTail >= chunk->n)
+    {
+        fromTail -= chunk->n;
+        chunk = chunk->prev;
+    }
+    offset = chunk->n - 1 - fromTail;
+    return chunk;
+}
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::insertAt(int index, T&& item)
+{
+    /**
+     * Inserts "item" at position "index" (0 <= index <= count).
+     */
+    Chunk* chunk;
+    int offset;
+    if (index == count)
+    {
+        chunk = tail->prev;
+        if (chunk == head || chunk->n == CHUNK)
+            chunk = newChunkAfter(tail->prev);
+        offset = chunk->n;
+    }
+    else
+    {
+        chunk = locate(index, offset);
+        if (chunk->n == CHUNK)
+        {
+            split(chunk);
+            if (offset > chunk->n)
+            {
+                offset -= chunk->n;
+                chunk = chunk->next;
+            }
+        }
+    }
+    insertIn(chunk, offset, std::move(item));
+    count++;
+}
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::insertIn(Chunk* chunk, int offset, T&& item)
+{
+    // chunk has room for one more item
+    T* items = chunk->items();
+    int n = chunk->n;
+    if (offset == n)
+        new (items + n) T(std::move(item));
+    else
+    {
+        new (items + n) T(std::move(items[n - 1]));
+        for (int idx = n - 1; idx > offset; idx--)
+            items[idx] = std::move(items[idx - 1]);
+        items[offset] = std::move(item);
+    }
+    chunk->n++;
+}
+
+template <class T, int CHUNK>
+void UnrolledLinkedList<T, CHUNK>::split(Chunk* chunk)
+{
+    /**
+     * Moves the upper half of a (full) chunk into a new chunk linked right after it.
+     */
+    Chunk* upper = newChunkAfter(chunk);
+    int half = chunk->n / 2;
+    T* from = chunk->items();
+    T* to = upper->items();
+    for (int idx = half; idx < chunk->n; idx++)
+    {
+        new (to + idx - half) T(std::move(from[idx]));
+        from[idx].~T();
+    }
+    upper->n = chunk->n - half;
+    chunk->n = half;
+}
+
+template <class T, int CHUNK>
+T UnrolledLinkedList<T, CHUNK>::eraseAt(Chunk* chunk, int offset)
+{
+    /**
+     * Removes and returns item "offset" of "chunk".
+     * Afterwards an empty chunk is freed; otherwise, if the next chunk fits into this one,
+     * its items are appended here and it is freed (merge).
+     * Only "chunk" and its successor change, which the iterators rely on.
+     */
+    T* items = chunk->items();
+    T removedValue = std::move(items[offset]);
+    for (int idx = offset; idx < chunk->n - 1; idx++)
+        items[idx] = std::move(items[idx + 1]);
+    items[chunk->n - 1].~T();
+    chunk->n--;
+    count--;
+
+    if (chunk->n == 0)
+        deleteChunk(chunk);
+    else
+    {
+        Chunk* next = chunk->next;
+        if (next != tail && chunk->n + next->n <= CHUNK)
+        {
+            T* from = next->items();
+            for (int idx = 0; idx < next->n; idx++)
+            {
+                new (items + chunk->n + idx) T(std::move(from[idx]));
+                from[idx].~T();
+            }
+            chunk->n += next->n;
+            next->n = 0;
+            deleteChunk(next);
+        }
+    }
+    return removedValue;
+}
+
+#endif /* UNROLLEDLINKEDLIST_H */
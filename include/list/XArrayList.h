@@ -0,0 +1,616 @@
+/*
+ * File:   XArrayList.h
+ */
+
+#ifndef XARRAYLIST_H
+#define XARRAYLIST_H
+
+#include <iostream>
+#include <sstream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+
+#include "list/IList.h"
+using namespace std;
+
+/*
+ * XArrayList<T>: a growable contiguous array implementing IList<T>
+ *  + items are stored in one dynamic array: get(index) is O(1) and traversal is cache-friendly
+ *  + the array grows geometrically (x1.5), so add(e) is amortized O(1)
+ *  + add/removeAt in the middle shift (move) the items behind "index"
+ *  + T does not need a default constructor: slots beyond "count" are raw memory
+ */
+template <class T>
+class XArrayList : public IList<T>
+{
+public:
+    class Iterator; // forward declaration
+
+protected:
+    T* data;       // dynamic array; only data[0 .. count-1] hold constructed items
+    int capacity;  // number of slots allocated for "data"
+    int count;     // number of items stored in the list
+    bool (*itemEqual)(T& lhs, T& rhs);        // function pointer: test if two items (type: T&) are equal or not
+    void (*deleteUserData)(XArrayList<T>*);  // function pointer: be called to remove items (if they are pointer type)
+
+public:
+    XArrayList(
+        void (*deleteUserData)(XArrayList<T>*) = 0,
+        bool (*itemEqual)(T&, T&) = 0,
+        int capacity = 10);
+    XArrayList(const XArrayList<T>& list);
+    XArrayList(XArrayList<T>&& list);
+    XArrayList<T>& operator=(const XArrayList<T>& list);
+    XArrayList<T>& operator=(XArrayList<T>&& list);
+    ~XArrayList();
+
+    // Inherit from IList: BEGIN
+    void add(const T& e);
+    void add(T&& e);
+    void add(int index, const T& e);
+    void add(int index, T&& e);
+    T removeAt(int index);
+    bool removeItem(T item, void (*removeItemData)(T) = 0);
+    bool empty();
+    int size();
+    void clear();
+    T& get(int index);
+    int indexOf(T item);
+    bool contains(T item);
+    string toString(string (*item2str)(T&) = 0);
+    // Inherit from IList: END
+
+    /*
+     * emplace_back(args...), emplace(index, args...):
+     *  construct the item from "args", return a reference to the stored item
+     */
+    template <class... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (count == capacity)
+        {
+            T item(std::forward<Args>(args)...); // args may refer to an item of this list
+            reallocate(grownCapacity(count + 1));
+            new (data + count) T(std::move(item));
+        }
+        else
+            new (data + count) T(std::forward<Args>(args)...);
+        return data[count++];
+    }
+    template <class... Args>
+    T& emplace(int index, Args&&... args)
+    {
+        checkIndex(index);
+        T item(std::forward<Args>(args)...);
+        insertAt(index, std::move(item));
+        return data[index];
+    }
+
+    /*
+     * reserve(minCapacity): make room for at least minCapacity items without changing the content
+     * shrink_to_fit(): give back the unused slots (capacity becomes size())
+     */
+    void reserve(int minCapacity)
+    {
+        if (minCapacity > capacity)
+            reallocate(minCapacity);
+    }
+    void shrink_to_fit()
+    {
+        if (count < capacity)
+            reallocate(count);
+    }
+    int getCapacity()
+    {
+        return capacity;
+    }
+    T& operator[](int index)
+    {
+        return data[index];
+    }
+
+    void dump()
+    {
+        cout << "XArrayList: count = " << count << ", capacity = " << capacity << endl;
+        cout << toString() << endl;
+    }
+    void println(string (*item2str)(T&) = 0)
+    {
+        cout << toString(item2str) << endl;
+    }
+    void setDeleteUserDataPtr(void (*deleteUserData)(XArrayList<T>*) = 0)
+    {
+        this->deleteUserData = deleteUserData;
+    }
+
+    /*
+     * free(XArrayList<T> *list):
+     *  + to remove user's data (type T, must be a pointer type, e.g.: int*, Point*)
+     *  + if users want a XArrayList removing their data,
+     *      he/she must pass "free" to constructor of XArrayList
+     *      Example:
+     *      XArrayList<T> list(&XArrayList<T>::free);
+     */
+    static void free(XArrayList<T>* list)
+    {
+        for (int idx = 0; idx < list->count; idx++)
+            delete list->data[idx];
+    }
+
+    /* begin, end and Iterator helps user to traverse a list
+     * Iterator is a random-access iterator, so STL algorithms work on it:
+     *      std::sort(list.begin(), list.end());
+     */
+    Iterator begin()
+    {
+        return Iterator(this, 0);
+    }
+    Iterator end()
+    {
+        return Iterator(this, count);
+    }
+    Iterator begin() const
+    {
+        return Iterator(const_cast<XArrayList<T>*>(this), 0);
+    }
+    Iterator end() const
+    {
+        return Iterator(const_cast<XArrayList<T>*>(this), count);
+    }
+
+protected:
+    static bool equals(T& lhs, T& rhs, bool (*itemEqual)(T&, T&))
+    {
+        if (itemEqual == 0)
+            return lhs == rhs;
+        else
+            return itemEqual(lhs, rhs);
+    }
+    void checkIndex(int index);
+    int grownCapacity(int minCapacity)
+    {
+        int newCapacity = capacity + (capacity >> 1);
+        if (newCapacity < 10)
+            newCapacity = 10;
+        return newCapacity < minCapacity ? minCapacity : newCapacity;
+    }
+    void ensureCapacity(int minCapacity)
+    {
+        if (minCapacity > capacity)
+            reallocate(grownCapacity(minCapacity));
+    }
+    void reallocate(int newCapacity);
+    void insertAt(int index, T&& item);
+    void destroyAll();
+    void copyFrom(const XArrayList<T>& list);
+    void removeInternalData();
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+public:
+    class Iterator
+    {
+    private:
+        XArrayList<T>* pList;
+        int cursor;
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+        Iterator(XArrayList<T>* pList = 0, int index = 0)
+        {
+            this->pList = pList;
+            this->cursor = index;
+        }
+        Iterator& operator=(const Iterator& iterator)
+        {
+            this->pList = iterator.pList;
+            this->cursor = iterator.cursor;
+            return *this;
+        }
+        /*
+         * remove(): remove the current item;
+         *  the iterator goes back one step, so iterator++ reaches the next item
+         */
+        void remove(void (*removeItemData)(T) = 0)
+        {
+            T item = pList->removeAt(cursor);
+            if (removeItemData != 0)
+                removeItemData(item);
+            cursor -= 1;
+        }
+
+        T& operator*() const
+        {
+            return pList->data[cursor];
+        }
+        T* operator->() const
+        {
+            return pList->data + cursor;
+        }
+        T& operator[](difference_type n) const
+        {
+            return pList->data[cursor + n];
+        }
+        bool operator==(const Iterator& iterator) const
+        {
+            return cursor == iterator.cursor;
+        }
+        bool operator!=(const Iterator& iterator) const
+        {
+            return cursor != iterator.cursor;
+        }
+        bool operator<(const Iterator& iterator) const
+        {
+            return cursor < iterator.cursor;
+        }
+        bool operator>(const Iterator& iterator) const
+        {
+            return cursor > iterator.cursor;
+        }
+        bool operator<=(const Iterator& iterator) const
+        {
+            return cursor <= iterator.cursor;
+        }
+        bool operator>=(const Iterator& iterator) const
+        {
+            return cursor >= iterator.cursor;
+        }
+        // Prefix ++ overload
+        Iterator& operator++()
+        {
+            cursor++;
+            return *this;
+        }
+        // Postfix ++ overload
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++*this;
+            return iterator;
+        }
+        // Prefix -- overload
+        Iterator& operator--()
+        {
+            cursor--;
+            return *this;
+        }
+        // Postfix -- overload
+        Iterator operator--(int)
+        {
+            Iterator iterator = *this;
+            --*this;
+            return iterator;
+        }
+        Iterator& operator+=(difference_type n)
+        {
+            cursor += n;
+            return *this;
+        }
+        Iterator& operator-=(difference_type n)
+        {
+            cursor -= n;
+            return *this;
+        }
+        Iterator operator+(difference_type n) const
+        {
+            return Iterator(pList, cursor + n);
+        }
+        Iterator operator-(difference_type n) const
+        {
+            return Iterator(pList, cursor - n);
+        }
+        friend Iterator operator+(difference_type n, const Iterator& iterator)
+        {
+            return iterator + n;
+        }
+        difference_type operator-(const Iterator& iterator) const
+        {
+            return cursor - iterator.cursor;
+        }
+    };
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class T>
+XArrayList<T>::XArrayList(
+    void (*deleteUserData)(XArrayList<T>*),
+    bool (*itemEqual)(T&, T&),
+    int capacity)
+{
+    this->deleteUserData = deleteUserData;
+    this->itemEqual = itemEqual;
+    this->capacity = capacity > 0 ? capacity : 10;
+    this->count = 0;
+    this->data = static_cast<T*>(::operator new(sizeof(T) * this->capacity));
+}
+
+template <class T>
+XArrayList<T>::XArrayList(const XArrayList<T>& list)
+{
+    this->capacity = 0;
+    this->count = 0;
+    this->data = 0;
+    copyFrom(list);
+}
+
+template <class T>
+XArrayList<T>::XArrayList(XArrayList<T>&& list)
+{
+    /**
+     * Move constructor: takes over the array of "list"; "list" is left empty but usable.
+     */
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+    this->data = list.data;
+    this->capacity = list.capacity;
+    this->count = list.count;
+
+    list.data = 0;
+    list.capacity = 0;
+    list.count = 0;
+}
+
+template <class T>
+XArrayList<T>& XArrayList<T>::operator=(const XArrayList<T>& list)
+{
+    if (this == &list)
+        return *this;
+    removeInternalData();
+    copyFrom(list);
+    return *this;
+}
+
+template <class T>
+XArrayList<T>& XArrayList<T>::operator=(XArrayList<T>&& list)
+{
+    if (this == &list)
+        return *this;
+    removeInternalData();
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+    this->data = list.data;
+    this->capacity = list.capacity;
+    this->count = list.count;
+
+    list.data = 0;
+    list.capacity = 0;
+    list.count = 0;
+    return *this;
+}
+
+template <class T>
+XArrayList<T>::~XArrayList()
+{
+    removeInternalData();
+}
+
+template <class T>
+void XArrayList<T>::add(const T& e)
+{
+    emplace_back(e);
+}
+
+template <class T>
+void XArrayList<T>::add(T&& e)
+{
+    emplace_back(std::move(e));
+}
+
+template <class T>
+void XArrayList<T>::add(int index, const T& e)
+{
+    checkIndex(index);
+    T item(e); // e may refer to an item of this list
+    insertAt(index, std::move(item));
+}
+
+template <class T>
+void XArrayList<T>::add(int index, T&& e)
+{
+    checkIndex(index);
+    insertAt(index, std::move(e));
+}
+
+template <class T>
+T XArrayList<T>::removeAt(int index)
+{
+    if (index < 0 || index >= count)
+        throw std::out_of_range("Index is out of range!");
+
+    T removedValue = std::move(data[index]);
+    std::move(data + index + 1, data + count, data + index);
+    data[count - 1].~T();
+    count--;
+    return removedValue;
+}
+
+template <class T>
+bool XArrayList<T>::removeItem(T item, void (*removeItemData)(T))
+{
+    int index = indexOf(item);
+    if (index < 0)
+        return false;
+    if (removeItemData != 0)
+        removeItemData(data[index]);
+    removeAt(index);
+    return true;
+}
+
+template <class T>
+bool XArrayList<T>::empty()
+{
+    return count == 0;
+}
+
+template <class T>
+int XArrayList<T>::size()
+{
+    return count;
+}
+
+template <class T>
+void XArrayList<T>::clear()
+{
+    /**
+     * Removes all items (and user's data, if deleteUserData is set).
+     * The array is kept, so refilling the list does not allocate; use shrink_to_fit to release it.
+     */
+    if (deleteUserData != 0)
+        deleteUserData(this);
+    destroyAll();
+}
+
+template <class T>
+T& XArrayList<T>::get(int index)
+{
+    if (index < 0 || index >= count)
+        throw std::out_of_range("Index is out of range!");
+    return data[index];
+}
+
+template <class T>
+int XArrayList<T>::indexOf(T item)
+{
+    for (int idx = 0; idx < count; idx++)
+    {
+        if (equals(data[idx], item, this->itemEqual))
+            return idx;
+    }
+    return -1;
+}
+
+template <class T>
+bool XArrayList<T>::contains(T item)
+{
+    return indexOf(item) != -1;
+}
+
+template <class T>
+string XArrayList<T>::toString(string (*item2str)(T&))
+{
+    stringstream os;
+    os << "[";
+    for (int idx = 0; idx < count; idx++)
+    {
+        if (idx > 0)
+            os << ", ";
+        if (item2str != 0)
+            os << item2str(data[idx]);
+        else
+            os << data[idx];
+    }
+    os << "]";
+    return os.str();
+}
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// (protected) METHOD DEFNITION ////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class T>
+void XArrayList<T>::checkIndex(int index)
+{
+    /**
+     * Valid positions for insertion are 0..count (inclusive).
+     */
+    if (index < 0 || index > count)
+        throw std::out_of_range("Index is out of range!");
+}
+
+template <class T>
+void XArrayList<T>::reallocate(int newCapacity)
+{
+    /**
+     * Moves the items into a new array of newCapacity slots (newCapacity >= count).
+     */
+    if (newCapacity < 1)
+        newCapacity = 1;
+    T* newData = static_cast<T*>(::operator new(sizeof(T) * newCapacity));
+    for (int idx = 0; idx < count; idx++)
+    {
+        new (newData + idx) T(std::move(data[idx]));
+        data[idx].~T();
+    }
+    ::operator delete(data);
+    data = newData;
+    capacity = newCapacity;
+}
+
+template <class T>
+void XArrayList<T>::insertAt(int index, T&& item)
+{
+    /**
+     * Inserts "item" at "index" (0 <= index <= count), shifting data[index..count-1] one slot right.
+     */
+    ensureCapacity(count + 1);
+    if (index == count)
+    {
+        new (data + count) T(std::move(item));
+    }
+    else
+    {
+        new (data + count) T(std::move(data[count - 1]));
+        std::move_backward(data + index, data + count - 1, data + count);
+        data[index] = std::move(item);
+    }
+    count++;
+}
+
+template <class T>
+void XArrayList<T>::destroyAll()
+{
+    if (!std::is_trivially_destructible<T>::value)
+    {
+        for (int idx = 0; idx < count; idx++)
+            data[idx].~T();
+    }
+    count = 0;
+}
+
+template <class T>
+void XArrayList<T>::copyFrom(const XArrayList<T>& list)
+{
+    /**
+     * Makes this list an item-by-item copy of "list" (same capacity, same function pointers).
+     * Expects this list to hold no array.
+     */
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+    this->capacity = list.capacity > 0 ? list.capacity : 10;
+    this->count = 0;
+    this->data = static_cast<T*>(::operator new(sizeof(T) * this->capacity));
+    for (int idx = 0; idx < list.count; idx++)
+    {
+        new (data + idx) T(list.data[idx]);
+        count++;
+    }
+}
+
+template <class T>
+void XArrayList<T>::removeInternalData()
+{
+    /**
+     * Removes user's data (if required), destroys the items and frees the array.
+     */
+    if (data == 0)
+        return;
+    clear();
+    ::operator delete(data);
+    data = 0;
+    capacity = 0;
+}
+
+#endif /* XARRAYLIST_H */
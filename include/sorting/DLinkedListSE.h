@@ -30,6 +30,9 @@ public:
     {
         this->copyFrom(list);
     }
+    DLinkedListSE(DLinkedList<T> &&list) : DLinkedList<T>(std::move(list))
+    {
+    }
 
     void sort(int (*comparator)(T &, T &) = 0)
     {
@@ -50,6 +53,7 @@ public:
             this->tail->prev = last;
             this->head->next = first;
             first->prev = this->head;
+            this->invalidateCursor();
         }
 
     };
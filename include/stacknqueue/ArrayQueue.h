@@ -0,0 +1,396 @@
+/*
+ * File:   ArrayQueue.h
+ *
+ * ArrayQueue<T>: Queue<T> on a circular buffer;
+ *  push/pop only move the head/rear indexes, so they never allocate once the capacity is reached
+ */
+
+#ifndef ARRAYQUEUE_H
+#define ARRAYQUEUE_H
+
+#include <new>
+#include <utility>
+#include <stdexcept>
+#include "list/DLinkedList.h"
+#include "stacknqueue/IDeck.h"
+
+template <class T>
+class ArrayQueue : public IDeck<T>
+{
+public:
+    class Iterator; // forward declaration
+
+protected:
+    T *data;      // raw storage: items live at head, head+1, ... (modulo capacity)
+    int capacity; // always a power of two, so "index & (capacity - 1)" wraps around
+    int head;     // slot of the front item
+    int count;
+    void (*deleteUserData)(DLinkedList<T> *); // same signature as Queue<T>, so both are interchangeable
+    bool (*itemEqual)(T &lhs, T &rhs);
+
+public:
+    ArrayQueue(
+        void (*deleteUserData)(DLinkedList<T> *) = 0,
+        bool (*itemEqual)(T &, T &) = 0,
+        int capacity = 16);
+    ArrayQueue(const ArrayQueue<T> &queue);
+    ArrayQueue(ArrayQueue<T> &&queue);
+    ArrayQueue<T> &operator=(const ArrayQueue<T> &queue);
+    ArrayQueue<T> &operator=(ArrayQueue<T> &&queue);
+    ~ArrayQueue();
+
+    // Inherit from IDeck: BEGIN
+    void push(T item);
+    T pop();
+    T &peek();
+    bool empty();
+    int size();
+    void clear();
+    bool remove(T item);
+    bool contains(T item);
+    string toString(string (*item2str)(T &) = 0);
+    // Inherit from IDeck: END
+
+    /*
+     * reserve(capacity): make room for "capacity" items, so the next pushes do not reallocate
+     */
+    void reserve(int capacity);
+    int getCapacity()
+    {
+        return capacity;
+    }
+    void println(string (*item2str)(T &) = 0)
+    {
+        cout << toString(item2str) << endl;
+    }
+
+    ///
+
+    Iterator front()
+    {
+        return Iterator(this, true);
+    }
+    Iterator rear()
+    {
+        return Iterator(this, false);
+    }
+
+protected:
+    // item at position "index" from the front
+    T &at(int index)
+    {
+        return data[(head + index) & (capacity - 1)];
+    }
+    void removeAt(int index);
+    void reallocate(int newCapacity);
+    void destroyAll();
+    void copyFrom(const ArrayQueue<T> &queue);
+    static int roundUp(int capacity)
+    {
+        int cap = 1;
+        while (cap < capacity)
+            cap <<= 1;
+        return cap;
+    }
+    static bool equals(T &lhs, T &rhs, bool (*itemEqual)(T &, T &))
+    {
+        if (itemEqual == 0)
+            return lhs == rhs;
+        else
+            return itemEqual(lhs, rhs);
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+
+public:
+    // Iterator: BEGIN
+    class Iterator
+    {
+    private:
+        ArrayQueue<T> *queue;
+        int index; // position from the front
+
+    public:
+        Iterator(ArrayQueue<T> *queue = 0, bool begin = true)
+        {
+            this->queue = queue;
+            this->index = (begin || queue == 0) ? 0 : queue->count;
+        }
+        Iterator &operator=(const Iterator &iterator)
+        {
+            this->queue = iterator.queue;
+            this->index = iterator.index;
+            return *this;
+        }
+
+        T &operator*()
+        {
+            return queue->at(index);
+        }
+        bool operator!=(const Iterator &iterator)
+        {
+            return this->index != iterator.index;
+        }
+        // Prefix ++ overload
+        Iterator &operator++()
+        {
+            index++;
+            return *this;
+        }
+        // Postfix ++ overload
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++*this;
+            return iterator;
+        }
+        /*
+         * remove(): remove the current item;
+         *  the iterator goes back one step, so iterator++ reaches the next item
+         */
+        void remove(void (*removeItem)(T) = 0)
+        {
+            if (removeItem != 0)
+                removeItem(queue->at(index));
+            queue->removeAt(index);
+            index--;
+        }
+    };
+    // Iterator: END
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class T>
+ArrayQueue<T>::ArrayQueue(
+    void (*deleteUserData)(DLinkedList<T> *),
+    bool (*itemEqual)(T &, T &),
+    int capacity)
+{
+    this->deleteUserData = deleteUserData;
+    this->itemEqual = itemEqual;
+    this->capacity = roundUp(capacity < 1 ? 1 : capacity);
+    this->head = 0;
+    this->count = 0;
+    this->data = static_cast<T *>(::operator new(sizeof(T) * this->capacity));
+}
+
+template <class T>
+ArrayQueue<T>::ArrayQueue(const ArrayQueue<T> &queue)
+{
+    this->capacity = queue.capacity;
+    this->data = static_cast<T *>(::operator new(sizeof(T) * this->capacity));
+    copyFrom(queue);
+}
+
+template <class T>
+ArrayQueue<T>::ArrayQueue(ArrayQueue<T> &&queue)
+{
+    this->deleteUserData = queue.deleteUserData;
+    this->itemEqual = queue.itemEqual;
+    this->data = queue.data;
+    this->capacity = queue.capacity;
+    this->head = queue.head;
+    this->count = queue.count;
+
+    // leave "queue" empty but usable
+    queue.capacity = 1;
+    queue.head = queue.count = 0;
+    queue.data = static_cast<T *>(::operator new(sizeof(T)));
+}
+
+template <class T>
+ArrayQueue<T> &ArrayQueue<T>::operator=(const ArrayQueue<T> &queue)
+{
+    if (this == &queue)
+        return *this;
+    destroyAll();
+    if (capacity < queue.count)
+    {
+        ::operator delete(data);
+        capacity = queue.capacity;
+        data = static_cast<T *>(::operator new(sizeof(T) * capacity));
+    }
+    copyFrom(queue);
+    return *this;
+}
+
+template <class T>
+ArrayQueue<T> &ArrayQueue<T>::operator=(ArrayQueue<T> &&queue)
+{
+    if (this == &queue)
+        return *this;
+    std::swap(deleteUserData, queue.deleteUserData);
+    std::swap(itemEqual, queue.itemEqual);
+    std::swap(data, queue.data);
+    std::swap(capacity, queue.capacity);
+    std::swap(head, queue.head);
+    std::swap(count, queue.count);
+    queue.clear();
+    return *this;
+}
+
+template <class T>
+ArrayQueue<T>::~ArrayQueue()
+{
+    destroyAll();
+    ::operator delete(data);
+}
+
+template <class T>
+void ArrayQueue<T>::push(T item)
+{
+    if (count == capacity)
+        reallocate(capacity * 2);
+    new (&data[(head + count) & (capacity - 1)]) T(std::move(item));
+    count++;
+}
+
+template <class T>
+T ArrayQueue<T>::pop()
+{
+    if (count == 0)
+        throw Underflow("Queue");
+    T item = std::move(data[head]);
+    data[head].~T();
+    head = (head + 1) & (capacity - 1);
+    count--;
+    return item;
+}
+
+template <class T>
+T &ArrayQueue<T>::peek()
+{
+    if (count == 0)
+        throw std::out_of_range("Index is out of range!");
+    return data[head];
+}
+
+template <class T>
+bool ArrayQueue<T>::empty()
+{
+    return count == 0;
+}
+
+template <class T>
+int ArrayQueue<T>::size()
+{
+    return count;
+}
+
+template <class T>
+void ArrayQueue<T>::clear()
+{
+    // keep the buffer: a cleared queue is usually refilled
+    destroyAll();
+}
+
+template <class T>
+bool ArrayQueue<T>::remove(T item)
+{
+    for (int idx = 0; idx < count; idx++)
+    {
+        if (equals(at(idx), item, this->itemEqual))
+        {
+            removeAt(idx);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <class T>
+bool ArrayQueue<T>::contains(T item)
+{
+    for (int idx = 0; idx < count; idx++)
+    {
+        if (equals(at(idx), item, this->itemEqual))
+            return true;
+    }
+    return false;
+}
+
+template <class T>
+string ArrayQueue<T>::toString(string (*item2str)(T &))
+{
+    stringstream os;
+    os << "FRONT-TO-REAR: [";
+    for (int idx = 0; idx < count; idx++)
+    {
+        if (item2str != 0)
+            os << item2str(at(idx));
+        else
+            os << at(idx);
+        if (idx < count - 1)
+            os << ", ";
+    }
+    os << "]";
+    return os.str();
+}
+
+template <class T>
+void ArrayQueue<T>::reserve(int capacity)
+{
+    if (capacity > this->capacity)
+        reallocate(roundUp(capacity));
+}
+
+/*
+ * removeAt(index): close the gap by moving the items behind "index" one slot forward
+ */
+template <class T>
+void ArrayQueue<T>::removeAt(int index)
+{
+    for (int idx = index; idx < count - 1; idx++)
+        at(idx) = std::move(at(idx + 1));
+    at(count - 1).~T();
+    count--;
+}
+
+/*
+ * reallocate(newCapacity): move the items to a new buffer, the front item goes to slot 0
+ */
+template <class T>
+void ArrayQueue<T>::reallocate(int newCapacity)
+{
+    T *newData = static_cast<T *>(::operator new(sizeof(T) * newCapacity));
+    for (int idx = 0; idx < count; idx++)
+    {
+        new (&newData[idx]) T(std::move(at(idx)));
+        at(idx).~T();
+    }
+    ::operator delete(data);
+    data = newData;
+    capacity = newCapacity;
+    head = 0;
+}
+
+template <class T>
+void ArrayQueue<T>::destroyAll()
+{
+    for (int idx = 0; idx < count; idx++)
+        at(idx).~T();
+    head = 0;
+    count = 0;
+}
+
+template <class T>
+void ArrayQueue<T>::copyFrom(const ArrayQueue<T> &queue)
+{
+    // "this->data" must already hold at least queue.count slots
+    this->deleteUserData = queue.deleteUserData;
+    this->itemEqual = queue.itemEqual;
+    this->head = 0;
+    this->count = 0;
+    for (int idx = 0; idx < queue.count; idx++)
+    {
+        new (&data[idx]) T(queue.data[(queue.head + idx) & (queue.capacity - 1)]);
+        count++;
+    }
+}
+
+#endif /* ARRAYQUEUE_H */
@@ -0,0 +1,129 @@
+/*
+ * File:   ArrayStack.h
+ *
+ * ArrayStack<T>: Stack<T> on a contiguous XArrayList<T>;
+ *  push/pop work at the end of the array, so they never allocate once the capacity is reached
+ */
+
+#ifndef ARRAYSTACK_H
+#define ARRAYSTACK_H
+
+#include "list/DLinkedList.h"
+#include "list/XArrayList.h"
+#include "stacknqueue/IDeck.h"
+
+template<class T>
+class ArrayStack: public IDeck<T>{
+public:
+    class Iterator; //forward declaration
+
+protected:
+    XArrayList<T> list; //internal array, the top is the last item
+    void (*deleteUserData)(DLinkedList<T>*); //same signature as Stack<T>, so both are interchangeable
+    bool (*itemEqual)(T& lhs, T& rhs); //function pointer: test if two items (type: T&) are equal or not
+
+public:
+    ArrayStack(  void (*deleteUserData)(DLinkedList<T>*)=0,
+            bool (*itemEqual)(T&, T&)=0,
+            int capacity=10): list(0, itemEqual, capacity){
+        this->itemEqual = itemEqual;
+        this->deleteUserData = deleteUserData;
+    }
+    void push(T item){
+        list.add(std::move(item));
+    }
+    T pop(){
+        if (list.empty()) throw Underflow("Stack");
+        return list.removeAt(list.size() - 1);
+    }
+    T& peek(){
+        return list.get(list.size() - 1);
+    }
+    bool empty(){
+        return list.size()==0;
+    }
+    int size(){
+        return list.size();
+    }
+    void clear(){
+        list.clear();
+    }
+    bool remove(T item){
+        return list.removeItem(item);
+    }
+    bool contains(T item){
+        return list.contains(item);
+    }
+    string  toString(string (*item2str)(T&)=0 ){
+        stringstream os;
+        os << "FROM TOP: " << list.toString(item2str);
+        return os.str();
+    }
+    void println(string (*item2str)(T&)=0 ){
+        cout << toString(item2str) << endl;
+    }
+    /*
+     * reserve(capacity): make room for "capacity" items, so the next pushes do not reallocate
+     */
+    void reserve(int capacity){
+        list.reserve(capacity);
+    }
+    int getCapacity(){
+        return list.getCapacity();
+    }
+    ///
+    Iterator top(){
+        return Iterator(this, true);
+    }
+    Iterator bottom(){
+        return Iterator(this, false);
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+
+public:
+
+//Iterator: BEGIN
+    class Iterator{
+    private:
+        ArrayStack<T>* stack;
+        typename XArrayList<T>::Iterator listIt;
+    public:
+        Iterator(ArrayStack<T>* stack=0, bool begin=true){
+            this->stack = stack;
+            if(stack != 0) this->listIt = begin ? stack->list.begin() : stack->list.end();
+        }
+        Iterator& operator=(const Iterator& iterator ){
+            this->stack = iterator.stack;
+            this->listIt = iterator.listIt;
+            return *this;
+        }
+
+        T& operator*(){
+            return *(this->listIt);
+        }
+        bool operator!=(const Iterator& iterator){
+            return this->listIt != iterator.listIt;
+        }
+        // Prefix ++ overload
+        Iterator& operator++(){
+            ++listIt;
+            return *this;
+        }
+        // Postfix ++ overload
+        Iterator operator++(int){
+            Iterator iterator = *this;
+            ++*this;
+            return iterator;
+        }
+        void remove(void (*removeItem)(T)=0){
+            listIt.remove(removeItem);
+        }
+    };
+    //Iterator: END
+};
+
+
+#endif /* ARRAYSTACK_H */
@@ -0,0 +1,686 @@
+/*
+ * File:   MPMCQueue.h
+ *
+ * Lock-free multi-producer/multi-consumer FIFO queues:
+ *  + MPMCQueue<T>: bounded ring buffer (capacity rounded up to a power of two)
+ *  + SegmentedMPMCQueue<T, SEGMENT>: unbounded, a chain of fixed-size segments
+ */
+
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include <atomic>
+#include <thread>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include "list/DLinkedList.h"
+#include "stacknqueue/IDeck.h"
+
+/*
+ * MPMCQueue<T>: bounded lock-free queue (Vyukov's ring of sequenced cells)
+ *  + thread-safe: push, pop, try_push, try_pop, size, empty
+ *      >> try_push: false when the queue is full;
+ *      >> try_pop: false when the queue is empty (or its front item is still being written)
+ *      >> push: waits (yield) while the queue is full
+ *      >> pop: throws Underflow when try_pop fails, as Queue<T> does on an empty queue
+ *      >> size: a snapshot, it may be stale as soon as it returns
+ *  + NOT thread-safe (call them when no other thread uses the queue):
+ *      peek, clear, remove, contains, toString
+ */
+template <class T>
+class MPMCQueue : public IDeck<T>
+{
+public:
+    class Cell; // forward declaration
+
+protected:
+    static const int CACHE_LINE = 64;
+
+    Cell* buffer;
+    size_t mask; // capacity - 1
+    bool (*itemEqual)(T& lhs, T& rhs);
+    // producers and consumers spin on different cache lines
+    alignas(CACHE_LINE) atomic<size_t> enqueuePos;
+    alignas(CACHE_LINE) atomic<size_t> dequeuePos;
+
+public:
+    MPMCQueue(int capacity = 1024, bool (*itemEqual)(T&, T&) = 0);
+    MPMCQueue(const MPMCQueue<T>& queue) = delete;
+    MPMCQueue<T>& operator=(const MPMCQueue<T>& queue) = delete;
+    ~MPMCQueue();
+
+    bool try_push(const T& item)
+    {
+        return tryEmplace(item);
+    }
+    bool try_push(T&& item)
+    {
+        return tryEmplace(std::move(item));
+    }
+    bool try_pop(T& item);
+
+    // Inherit from IDeck: BEGIN
+    void push(T item);
+    T pop();
+    T& peek();
+    bool empty();
+    int size();
+    void clear();
+    bool remove(T item);
+    bool contains(T item);
+    string toString(string (*item2str)(T&) = 0);
+    // Inherit from IDeck: END
+
+    int getCapacity()
+    {
+        return (int)(mask + 1);
+    }
+    void println(string (*item2str)(T&) = 0)
+    {
+        cout << toString(item2str) << endl;
+    }
+
+protected:
+    template <class U>
+    bool tryEmplace(U&& item);
+
+    static bool equals(T& lhs, T& rhs, bool (*itemEqual)(T&, T&))
+    {
+        if (itemEqual == 0)
+            return lhs == rhs;
+        else
+            return itemEqual(lhs, rhs);
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+public:
+    /*
+     * Cell: sequence == pos       >> free, the producer of ticket "pos" may write it
+     *       sequence == pos + 1   >> full, the consumer of ticket "pos" may read it
+     */
+    class Cell
+    {
+    public:
+        atomic<size_t> sequence;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        T* item()
+        {
+            return reinterpret_cast<T*>(&storage);
+        }
+    };
+};
+
+/*
+ * SegmentedMPMCQueue<T, SEGMENT>: unbounded lock-free queue
+ *  + items are stored in segments of SEGMENT cells; a full segment gets a successor,
+ *      a drained segment is retired and freed once no operation can still see it
+ *  + same contract as MPMCQueue<T>, except that push/try_push never fail
+ */
+template <class T, int SEGMENT = 1024>
+class SegmentedMPMCQueue : public IDeck<T>
+{
+public:
+    class Segment; // forward declaration
+
+protected:
+    static const int CACHE_LINE = 64;
+
+    bool (*itemEqual)(T& lhs, T& rhs);
+    alignas(CACHE_LINE) atomic<Segment*> head;  // consumers
+    alignas(CACHE_LINE) atomic<Segment*> tail;  // producers
+    alignas(CACHE_LINE) atomic<int> activeOps;  // operations in progress
+    atomic<Segment*> retired;                   // drained segments, waiting to be freed
+
+public:
+    SegmentedMPMCQueue(bool (*itemEqual)(T&, T&) = 0);
+    SegmentedMPMCQueue(const SegmentedMPMCQueue<T, SEGMENT>& queue) = delete;
+    SegmentedMPMCQueue<T, SEGMENT>& operator=(const SegmentedMPMCQueue<T, SEGMENT>& queue) = delete;
+    ~SegmentedMPMCQueue();
+
+    bool try_push(const T& item)
+    {
+        emplaceItem(item);
+        return true;
+    }
+    bool try_push(T&& item)
+    {
+        emplaceItem(std::move(item));
+        return true;
+    }
+    bool try_pop(T& item);
+
+    // Inherit from IDeck: BEGIN
+    void push(T item);
+    T pop();
+    T& peek();
+    bool empty();
+    int size();
+    void clear();
+    bool remove(T item);
+    bool contains(T item);
+    string toString(string (*item2str)(T&) = 0);
+    // Inherit from IDeck: END
+
+    void println(string (*item2str)(T&) = 0)
+    {
+        cout << toString(item2str) << endl;
+    }
+
+protected:
+    template <class U>
+    void emplaceItem(U&& item);
+    void retire(Segment* segment);
+    void reclaim();
+    static void freeChain(Segment* segment);
+    static bool equals(T& lhs, T& rhs, bool (*itemEqual)(T&, T&))
+    {
+        if (itemEqual == 0)
+            return lhs == rhs;
+        else
+            return itemEqual(lhs, rhs);
+    }
+    /*
+     * OpGuard: counts the running operation in activeOps; a retired segment is freed
+     *  only by the last operation to leave, so nobody can hold a pointer to it
+     */
+    class OpGuard
+    {
+    private:
+        SegmentedMPMCQueue<T, SEGMENT>* queue;
+
+    public:
+        OpGuard(SegmentedMPMCQueue<T, SEGMENT>* queue) : queue(queue)
+        {
+            queue->activeOps.fetch_add(1);
+        }
+        ~OpGuard()
+        {
+            if (queue->retired.load() != 0)
+                queue->reclaim();
+            queue->activeOps.fetch_sub(1);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+public:
+    class Segment
+    {
+    public:
+        class Cell
+        {
+        public:
+            atomic<bool> ready;
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+            T* item()
+            {
+                return reinterpret_cast<T*>(&storage);
+            }
+        };
+
+        alignas(CACHE_LINE) atomic<long long> enqueueIdx; // next cell to claim (may pass SEGMENT)
+        alignas(CACHE_LINE) atomic<long long> dequeueIdx; // next cell to read
+        atomic<Segment*> next;
+        Segment* nextRetired;
+        Cell cells[SEGMENT];
+
+        Segment() : enqueueIdx(0), dequeueIdx(0), next(0), nextRetired(0)
+        {
+            for (int idx = 0; idx < SEGMENT; idx++)
+                cells[idx].ready.store(false, memory_order_relaxed);
+        }
+        ~Segment()
+        {
+            // destroy the items that were pushed but never popped
+            long long last = enqueueIdx.load() < SEGMENT ? enqueueIdx.load() : SEGMENT;
+            for (long long idx = dequeueIdx.load(); idx < last; idx++)
+            {
+                if (cells[idx].ready.load())
+                    cells[idx].item()->~T();
+            }
+        }
+        int size()
+        {
+            long long last = enqueueIdx.load() < SEGMENT ? enqueueIdx.load() : SEGMENT;
+            long long first = dequeueIdx.load();
+            return last > first ? (int)(last - first) : 0;
+        }
+    };
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+// MPMCQueue<T>
+
+template <class T>
+MPMCQueue<T>::MPMCQueue(int capacity, bool (*itemEqual)(T&, T&))
+{
+    size_t cap = 2;
+    while (cap < (size_t)capacity)
+        cap <<= 1;
+    this->mask = cap - 1;
+    this->itemEqual = itemEqual;
+    this->buffer = new Cell[cap];
+    for (size_t idx = 0; idx < cap; idx++)
+        buffer[idx].sequence.store(idx, memory_order_relaxed);
+    enqueuePos.store(0, memory_order_relaxed);
+    dequeuePos.store(0, memory_order_relaxed);
+}
+
+template <class T>
+MPMCQueue<T>::~MPMCQueue()
+{
+    clear();
+    delete[] buffer;
+}
+
+template <class T>
+template <class U>
+bool MPMCQueue<T>::tryEmplace(U&& item)
+{
+    size_t pos = enqueuePos.load(memory_order_relaxed);
+    Cell* cell;
+    while (true)
+    {
+        cell = &buffer[pos & mask];
+        size_t seq = cell->sequence.load(memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0)
+        {
+            // the cell is free for ticket "pos": claim the ticket
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+            return false; // the cell still holds the item of the previous lap: full
+        else
+            pos = enqueuePos.load(memory_order_relaxed);
+    }
+    new (cell->item()) T(std::forward<U>(item));
+    cell->sequence.store(pos + 1, memory_order_release);
+    return true;
+}
+
+template <class T>
+bool MPMCQueue<T>::try_pop(T& item)
+{
+    size_t pos = dequeuePos.load(memory_order_relaxed);
+    Cell* cell;
+    while (true)
+    {
+        cell = &buffer[pos & mask];
+        size_t seq = cell->sequence.load(memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0)
+        {
+            if (dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+            return false; // not written yet: empty
+        else
+            pos = dequeuePos.load(memory_order_relaxed);
+    }
+    item = std::move(*cell->item());
+    cell->item()->~T();
+    // free the cell for the producer of the next lap
+    cell->sequence.store(pos + mask + 1, memory_order_release);
+    return true;
+}
+
+template <class T>
+void MPMCQueue<T>::push(T item)
+{
+    while (!tryEmplace(std::move(item)))
+        std::this_thread::yield();
+}
+
+template <class T>
+T MPMCQueue<T>::pop()
+{
+    T item;
+    if (!try_pop(item))
+        throw Underflow("MPMCQueue");
+    return item;
+}
+
+template <class T>
+T& MPMCQueue<T>::peek()
+{
+    size_t pos = dequeuePos.load(memory_order_acquire);
+    Cell* cell = &buffer[pos & mask];
+    if (cell->sequence.load(memory_order_acquire) != pos + 1)
+        throw Underflow("MPMCQueue");
+    return *cell->item();
+}
+
+template <class T>
+bool MPMCQueue<T>::empty()
+{
+    return size() == 0;
+}
+
+template <class T>
+int MPMCQueue<T>::size()
+{
+    size_t first = dequeuePos.load(memory_order_acquire);
+    size_t last = enqueuePos.load(memory_order_acquire);
+    return last > first ? (int)(last - first) : 0;
+}
+
+template <class T>
+void MPMCQueue<T>::clear()
+{
+    T item;
+    while (try_pop(item))
+        ;
+}
+
+template <class T>
+bool MPMCQueue<T>::remove(T item)
+{
+    // drain, then push back everything except the first match (keeps the order)
+    DLinkedList<T> items;
+    T current;
+    bool found = false;
+    while (try_pop(current))
+    {
+        if (!found && equals(current, item, this->itemEqual))
+            found = true;
+        else
+            items.add(std::move(current));
+    }
+    for (typename DLinkedList<T>::Iterator it = items.begin(); it != items.end(); ++it)
+        tryEmplace(std::move(*it));
+    return found;
+}
+
+template <class T>
+bool MPMCQueue<T>::contains(T item)
+{
+    size_t last = enqueuePos.load(memory_order_acquire);
+    for (size_t pos = dequeuePos.load(memory_order_acquire); pos < last; pos++)
+    {
+        if (equals(*buffer[pos & mask].item(), item, this->itemEqual))
+            return true;
+    }
+    return false;
+}
+
+template <class T>
+string MPMCQueue<T>::toString(string (*item2str)(T&))
+{
+    stringstream os;
+    os << "FRONT-TO-REAR: [";
+    size_t first = dequeuePos.load(memory_order_acquire);
+    size_t last = enqueuePos.load(memory_order_acquire);
+    for (size_t pos = first; pos < last; pos++)
+    {
+        T& item = *buffer[pos & mask].item();
+        if (item2str != 0)
+            os << item2str(item);
+        else
+            os << item;
+        if (pos + 1 < last)
+            os << ", ";
+    }
+    os << "]";
+    return os.str();
+}
+
+//////////////////////////////////////////////////////////////////////
+// SegmentedMPMCQueue<T, SEGMENT>
+
+template <class T, int SEGMENT>
+SegmentedMPMCQueue<T, SEGMENT>::SegmentedMPMCQueue(bool (*itemEqual)(T&, T&))
+{
+    this->itemEqual = itemEqual;
+    Segment* first = new Segment();
+    head.store(first);
+    tail.store(first);
+    activeOps.store(0);
+    retired.store(0);
+}
+
+template <class T, int SEGMENT>
+SegmentedMPMCQueue<T, SEGMENT>::~SegmentedMPMCQueue()
+{
+    Segment* segment = head.load();
+    while (segment != 0)
+    {
+        Segment* next = segment->next.load();
+        delete segment;
+        segment = next;
+    }
+    freeChain(retired.load());
+}
+
+template <class T, int SEGMENT>
+template <class U>
+void SegmentedMPMCQueue<T, SEGMENT>::emplaceItem(U&& item)
+{
+    OpGuard guard(this);
+    while (true)
+    {
+        Segment* segment = tail.load();
+        long long idx = segment->enqueueIdx.fetch_add(1);
+        if (idx < SEGMENT)
+        {
+            typename Segment::Cell& cell = segment->cells[idx];
+            new (cell.item()) T(std::forward<U>(item));
+            cell.ready.store(true, memory_order_release);
+            return;
+        }
+        // the segment is full: link a successor (one producer wins), then move tail on
+        Segment* next = segment->next.load();
+        if (next == 0)
+        {
+            Segment* fresh = new Segment();
+            if (segment->next.compare_exchange_strong(next, fresh))
+                next = fresh;
+            else
+                delete fresh;
+        }
+        tail.compare_exchange_strong(segment, next);
+    }
+}
+
+template <class T, int SEGMENT>
+bool SegmentedMPMCQueue<T, SEGMENT>::try_pop(T& item)
+{
+    OpGuard guard(this);
+    while (true)
+    {
+        Segment* segment = head.load();
+        long long idx = segment->dequeueIdx.load();
+        if (idx >= SEGMENT)
+        {
+            // drained: move head (and tail, if it lags) to the successor
+            Segment* next = segment->next.load();
+            if (next == 0)
+                return false;
+            Segment* expected = segment;
+            tail.compare_exchange_strong(expected, next);
+            expected = segment;
+            if (head.compare_exchange_strong(expected, next))
+                retire(segment);
+            continue;
+        }
+        typename Segment::Cell& cell = segment->cells[idx];
+        if (!cell.ready.load(memory_order_acquire))
+            return false; // empty, or its producer has not finished writing
+        if (segment->dequeueIdx.compare_exchange_weak(idx, idx + 1))
+        {
+            item = std::move(*cell.item());
+            cell.item()->~T();
+            return true;
+        }
+    }
+}
+
+template <class T, int SEGMENT>
+void SegmentedMPMCQueue<T, SEGMENT>::retire(Segment* segment)
+{
+    Segment* top = retired.load();
+    do
+    {
+        segment->nextRetired = top;
+    } while (!retired.compare_exchange_weak(top, segment));
+}
+
+template <class T, int SEGMENT>
+void SegmentedMPMCQueue<T, SEGMENT>::reclaim()
+{
+    // take the list first, then check: any operation that could still see one of these
+    // segments started before it was retired, so it would be counted in activeOps
+    Segment* list = retired.exchange(0);
+    if (list == 0)
+        return;
+    if (activeOps.load() == 1)
+    {
+        freeChain(list);
+        return;
+    }
+    // others are running: give the list back
+    Segment* last = list;
+    while (last->nextRetired != 0)
+        last = last->nextRetired;
+    Segment* top = retired.load();
+    do
+    {
+        last->nextRetired = top;
+    } while (!retired.compare_exchange_weak(top, list));
+}
+
+template <class T, int SEGMENT>
+void SegmentedMPMCQueue<T, SEGMENT>::freeChain(Segment* segment)
+{
+    while (segment != 0)
+    {
+        Segment* next = segment->nextRetired;
+        delete segment;
+        segment = next;
+    }
+}
+
+template <class T, int SEGMENT>
+void SegmentedMPMCQueue<T, SEGMENT>::push(T item)
+{
+    emplaceItem(std::move(item));
+}
+
+template <class T, int SEGMENT>
+T SegmentedMPMCQueue<T, SEGMENT>::pop()
+{
+    T item;
+    if (!try_pop(item))
+        throw Underflow("SegmentedMPMCQueue");
+    return item;
+}
+
+template <class T, int SEGMENT>
+T& SegmentedMPMCQueue<T, SEGMENT>::peek()
+{
+    for (Segment* segment = head.load(); segment != 0; segment = segment->next.load())
+    {
+        long long idx = segment->dequeueIdx.load();
+        if (idx < SEGMENT)
+        {
+            if (!segment->cells[idx].ready.load(memory_order_acquire))
+                break;
+            return *segment->cells[idx].item();
+        }
+    }
+    throw Underflow("SegmentedMPMCQueue");
+}
+
+template <class T, int SEGMENT>
+bool SegmentedMPMCQueue<T, SEGMENT>::empty()
+{
+    return size() == 0;
+}
+
+template <class T, int SEGMENT>
+int SegmentedMPMCQueue<T, SEGMENT>::size()
+{
+    OpGuard guard(this);
+    int count = 0;
+    for (Segment* segment = head.load(); segment != 0; segment = segment->next.load())
+        count += segment->size();
+    return count;
+}
+
+template <class T, int SEGMENT>
+void SegmentedMPMCQueue<T, SEGMENT>::clear()
+{
+    T item;
+    while (try_pop(item))
+        ;
+}
+
+template <class T, int SEGMENT>
+bool SegmentedMPMCQueue<T, SEGMENT>::remove(T item)
+{
+    DLinkedList<T> items;
+    T current;
+    bool found = false;
+    while (try_pop(current))
+    {
+        if (!found && equals(current, item, this->itemEqual))
+            found = true;
+        else
+            items.add(std::move(current));
+    }
+    for (typename DLinkedList<T>::Iterator it = items.begin(); it != items.end(); ++it)
+        emplaceItem(std::move(*it));
+    return found;
+}
+
+template <class T, int SEGMENT>
+bool SegmentedMPMCQueue<T, SEGMENT>::contains(T item)
+{
+    for (Segment* segment = head.load(); segment != 0; segment = segment->next.load())
+    {
+        long long last = segment->enqueueIdx.load() < SEGMENT ? segment->enqueueIdx.load() : SEGMENT;
+        for (long long idx = segment->dequeueIdx.load(); idx < last; idx++)
+        {
+            if (equals(*segment->cells[idx].item(), item, this->itemEqual))
+                return true;
+        }
+    }
+    return false;
+}
+
+template <class T, int SEGMENT>
+string SegmentedMPMCQueue<T, SEGMENT>::toString(string (*item2str)(T&))
+{
+    stringstream os;
+    os << "FRONT-TO-REAR: [";
+    bool first = true;
+    for (Segment* segment = head.load(); segment != 0; segment = segment->next.load())
+    {
+        long long last = segment->enqueueIdx.load() < SEGMENT ? segment->enqueueIdx.load() : SEGMENT;
+        for (long long idx = segment->dequeueIdx.load(); idx < last; idx++)
+        {
+            T& item = *segment->cells[idx].item();
+            if (!first)
+                os << ", ";
+            if (item2str != 0)
+                os << item2str(item);
+            else
+                os << item;
+            first = false;
+        }
+    }
+    os << "]";
+    return os.str();
+}
+
+#endif /* MPMCQUEUE_H */
@@ -17,6 +17,16 @@
 #include "list/DLinkedList.h"
 #include "stacknqueue/IDeck.h"
 
+/*
+ * Build with -DDSA_ARRAY_DECK to make Queue<T> the array-backed ArrayQueue<T>
+ *  (same constructor and API, but push/pop do not allocate a node per item)
+ */
+#ifdef DSA_ARRAY_DECK
+#include "stacknqueue/ArrayQueue.h"
+template <class T>
+using Queue = ArrayQueue<T>;
+#else
+
 template <class T>
 class Queue : public IDeck<T>
 {
@@ -39,7 +49,7 @@ public:
     void push(T item)
     {
         // TODO: add item to the rear
-        list.add(item);
+        list.add(std::move(item));
     }
     T pop()
     {
@@ -189,4 +199,6 @@ public:
     // Iterator: END
 };
 
+#endif /* DSA_ARRAY_DECK */
+
 #endif /* QUEUE_H */
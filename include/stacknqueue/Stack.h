@@ -19,6 +19,16 @@
 #include "list/DLinkedList.h"
 #include "stacknqueue/IDeck.h"
 
+/*
+ * Build with -DDSA_ARRAY_DECK to make Stack<T> the array-backed ArrayStack<T>
+ *  (same constructor and API, but push/pop do not allocate a node per item)
+ */
+#ifdef DSA_ARRAY_DECK
+#include "stacknqueue/ArrayStack.h"
+template <class T>
+using Stack = ArrayStack<T>;
+#else
+
 template<class T>
 class Stack: public IDeck<T>{
 public:
@@ -37,7 +47,7 @@ public:
     }
     void push(T item){
         //TODO: add item to the top
-        list.add(item);
+        list.add(std::move(item));
     }
     T pop(){
         //TODO: remove and return the top item
@@ -152,5 +162,7 @@ public:
 };
 
 
+#endif /* DSA_ARRAY_DECK */
+
 #endif /* STACK_H */
 
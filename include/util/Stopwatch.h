@@ -0,0 +1,51 @@
+/*
+ * File:   Stopwatch.h
+ *
+ * Small timing helpers shared by the benchmarks under demo/
+ */
+
+#ifndef STOPWATCH_H
+#define STOPWATCH_H
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+using namespace std;
+
+class Stopwatch{
+private:
+    chrono::steady_clock::time_point start;
+public:
+    Stopwatch(){
+        reset();
+    }
+    void reset(){
+        start = chrono::steady_clock::now();
+    }
+    /* elapsed time since construction / last reset */
+    double millis(){
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    }
+    double nanos(){
+        return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    }
+};
+
+/*
+ * benchRow: print one line of a benchmark table
+ *  >> name: case name; ms: total time; nops: number of operations timed
+ */
+inline void benchRow(string name, double ms, long long nops){
+    cout    << setw(36) << left << name
+            << setw(12) << right << fixed << setprecision(2) << ms << " ms"
+            << setw(12) << right << fixed << setprecision(1)
+            << (nops > 0 ? ms * 1e6 / nops : 0.0) << " ns/op" << endl;
+}
+
+/* keep the optimizer from removing a computed value */
+template<class T>
+inline void benchKeep(T const& value){
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+#endif /* STOPWATCH_H */
@@ -15,6 +15,7 @@
 
 Config::Config(string cfg_filename): m_cfg_filename(cfg_filename) {
    m_pMap = new xmap<string, string>(&stringHash);
+   m_pMap->setViewHash(&stringViewHash); // get("model_root", ...) builds no string
     //
    load_default();
    load_from(cfg_filename);
@@ -67,15 +68,9 @@ void Config::load_from(string filename){
     }
     datastream.close();
 }
-string Config::get(string key, string def_value){
-    string value;
-    try{
-        value = m_pMap->get(key);
-    }
-    catch(KeyNotFound& e){
-        value = def_value;
-    }
-    return value;
+string Config::get(string_view key, const string& def_value){
+    string* value = m_pMap->find(key); //one lookup
+    return value != 0 ? *value : def_value;
 }
 string Config::get_new_checkpoint(string model_name){
     string model_root = get("model_root", "./models");
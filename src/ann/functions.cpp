@@ -1,4 +1,5 @@
 #include "ann/functions.h"
+#include "hash/HashFunctions.h"
 #include <cinttypes>
 #include <cstdint>
 #include <cstdio>
@@ -52,9 +53,10 @@ xt::xarray<double> onehot_enc(xt::xarray<unsigned long> x, int nclasses){
 }
 
 int stringHash(string& str, int size) {
-    long long int sum = 0;
-    for (int idx = 0; idx < str.length(); idx++) sum += str[idx];
-    return sum % size;
+    return wyStringHash(str, size);
+}
+int stringViewHash(string_view str, int size) {
+    return wyViewHash(str, size);
 }
 
 // trim from start (in place)
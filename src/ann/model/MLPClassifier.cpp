@@ -25,6 +25,7 @@ namespace fs = std::filesystem;
 #include "layer/Tanh.h"
 #include "layer/Softmax.h"
 #include "metrics/ClassMetrics.h"
+#include "heap/TopK.h"
 
 
 
@@ -58,8 +59,7 @@ double_tensor MLPClassifier::predict(double_tensor X, bool make_decision){
     this->set_working_mode(false);
     
     //DO the inference
-    
-    //YOUR CODE IS HERE
+    double_tensor Y = this->forward(X);
     
     //RESTORE the previous mode
     this->set_working_mode(old_mode);
@@ -69,6 +69,47 @@ double_tensor MLPClassifier::predict(double_tensor X, bool make_decision){
     else return xt::argmax(Y, -1);
 }
 
+/*
+ * ClassScore: a class and its probability, ordered by probability;
+ *  on a tie, the smaller class index is the greater (as xt::argmax)
+ */
+struct ClassScore{
+    double score;
+    ulong label;
+    bool operator<(const ClassScore& rhs) const{
+        return score < rhs.score || (score == rhs.score && label > rhs.label);
+    }
+    bool operator==(const ClassScore& rhs) const{
+        return score == rhs.score && label == rhs.label;
+    }
+};
+ostream& operator<<(ostream& os, const ClassScore& item){
+    return os << item.label << ":" << item.score;
+}
+
+ulong_tensor MLPClassifier::predict_topk(double_tensor X, int k, double_tensor* pScores){
+    double_tensor Y = this->predict(X, true);
+    int nsamples = Y.shape()[0];
+    int nclasses = Y.shape()[1];
+    k = max(0, min(k, nclasses));
+    
+    ulong_tensor labels = xt::zeros<ulong>({(size_t)nsamples, (size_t)k});
+    double_tensor scores = xt::zeros<double>({(size_t)nsamples, (size_t)k});
+    TopK<ClassScore> best(k);
+    for(int row=0; row < nsamples; row++){
+        best.clear();
+        for(int label=0; label < nclasses; label++) 
+            best.offer(ClassScore{Y(row, label), (ulong)label});
+        vector<ClassScore> sorted = best.sorted();
+        for(int idx=0; idx < k; idx++){
+            labels(row, idx) = sorted[idx].label;
+            scores(row, idx) = sorted[idx].score;
+        }
+    }
+    if(pScores != 0) *pScores = scores;
+    return labels;
+}
+
 double_tensor MLPClassifier::predict(
     DataLoader<double, double>* pLoader,
     bool make_decision){
@@ -144,7 +185,8 @@ void MLPClassifier::set_working_mode(bool trainable){
 
 //protected: for the training mode: begin
 double_tensor MLPClassifier::forward(double_tensor X){
-    //YOUR CODE IS HERE
+    for(auto pLayer: m_layers) X = pLayer->forward(X);
+    return X;
 }
 void MLPClassifier::backward(){
     //YOUR CODE IS HERE
@@ -38,11 +38,10 @@ void AdaParamGroup::register_sample_count(unsigned long long* pCounter){
     m_pCounter = pCounter;
 }
 void AdaParamGroup::zero_grad(){
-    DLinkedList<string> keys = m_pGrads->keys();
-    for(auto key: keys){
-        xt::xarray<double>* pGrad = m_pGrads->get(key);
-        xt::xarray<double>* pSquaredGrad = m_pSquaredGrads->get(key);
-        xt::xarray<double>* pParam = m_pParams->get(key);
+    for(auto& entry: *m_pGrads){
+        xt::xarray<double>* pGrad = entry.getValue();
+        xt::xarray<double>* pSquaredGrad = m_pSquaredGrads->get(entry.getKey());
+        xt::xarray<double>* pParam = m_pParams->get(entry.getKey());
         *pGrad = xt::zeros<double>(pParam->shape());
         *pSquaredGrad = xt::zeros<double>(pParam->shape());
     }
@@ -51,12 +50,11 @@ void AdaParamGroup::zero_grad(){
 }
 
 void AdaParamGroup::step(double lr){
-    DLinkedList<string> keys = m_pGrads->keys();
-    for(auto key: keys){
-        xt::xarray<double>& grad_P = *m_pGrads->get(key);
-        xt::xarray<double>& squared_grad = *m_pSquaredGrads->get(key);
+    for(auto& entry: *m_pGrads){
+        xt::xarray<double>& grad_P = *entry.getValue();
+        xt::xarray<double>& squared_grad = *m_pSquaredGrads->get(entry.getKey());
         squared_grad = m_decay*squared_grad + (1 - m_decay)*grad_P*grad_P;
-        xt::xarray<double>& P = *m_pParams->get(key);
+        xt::xarray<double>& P = *m_pParams->get(entry.getKey());
         
         P = P - lr*grad_P/(xt::sqrt(squared_grad) + 1e-7);
     }
@@ -32,16 +32,14 @@ IOptimizer::~IOptimizer() {
 }
 
 void IOptimizer::step(){
-    DLinkedList<string> gkeys = m_pGroupMap->keys();
-    for(auto key: gkeys){
-        IParamGroup* pGroup = m_pGroupMap->get(key);
+    for(auto& entry: *m_pGroupMap){
+        IParamGroup* pGroup = entry.getValue();
         pGroup->step(m_fLearningRate);
     }
 }
 void IOptimizer::zero_grad(){
-    DLinkedList<string> keys = m_pGroupMap->keys();
-    for(auto key: keys){
-        IParamGroup* pGroup = m_pGroupMap->get(key);
+    for(auto& entry: *m_pGroupMap){
+        IParamGroup* pGroup = entry.getValue();
         pGroup->zero_grad();
     }
 };
\ No newline at end of file
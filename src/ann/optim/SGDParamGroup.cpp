@@ -31,10 +31,9 @@ void SGDParamGroup::register_sample_count(unsigned long long* pCounter){
     m_pCounter = pCounter;
 }
 void SGDParamGroup::zero_grad(){
-    DLinkedList<string> keys = m_pGrads->keys();
-    for(auto key: keys){
-        xt::xarray<double>* pGrad = m_pGrads->get(key);
-        xt::xarray<double>* pParam = m_pParams->get(key);
+    for(auto& entry: *m_pGrads){
+        xt::xarray<double>* pGrad = entry.getValue();
+        xt::xarray<double>* pParam = m_pParams->get(entry.getKey());
         *pGrad = xt::zeros<double>(pParam->shape());
     }
     //reset sample_counter
@@ -42,10 +41,9 @@ void SGDParamGroup::zero_grad(){
 }
 
 void SGDParamGroup::step(double lr){
-    DLinkedList<string> keys = m_pGrads->keys();
-    for(auto key: keys){
-        xt::xarray<double>& P = *m_pParams->get(key);
-        xt::xarray<double>& grad_P = *m_pGrads->get(key);
+    for(auto& entry: *m_pGrads){
+        xt::xarray<double>& P = *m_pParams->get(entry.getKey());
+        xt::xarray<double>& grad_P = *entry.getValue();
         P = P - lr*grad_P;
     }
 }
@@ -11,6 +11,14 @@
 
   ! build code topo : g++ -fsanitize=address -fsanitize=undefined -std=c++17 -o main -Iinclude -Itest main.cpp test/unit_test/graph/unit_test.cpp test/unit_test/graph/test/*.cpp  -DTEST_GRAPH
 
+  ! build code list : g++ -fsanitize=address -fsanitize=undefined -std=c++17 -o main -Iinclude -Itest main.cpp test/unit_test/list/unit_test.cpp test/unit_test/list/test/*.cpp  -DTEST_LIST
+
+  ! build code stacknqueue : g++ -fsanitize=address -fsanitize=undefined -std=c++17 -pthread -o main -Iinclude -Itest main.cpp test/unit_test/stacknqueue/unit_test.cpp test/unit_test/stacknqueue/test/*.cpp  -DTEST_STACKNQUEUE
+
+  ! build code hash : g++ -fsanitize=address -fsanitize=undefined -std=c++17 -pthread -o main -Iinclude -Itest main.cpp test/unit_test/hash/unit_test.cpp test/unit_test/hash/test/*.cpp  -DTEST_HASH
+
+  ! build code heap : g++ -fsanitize=address -fsanitize=undefined -std=c++17 -pthread -o main -Iinclude -Itest main.cpp test/unit_test/heap/unit_test.cpp test/unit_test/heap/test/*.cpp  -DTEST_HEAP
+
 
  * run code
     * terminal unit test array list
@@ -25,6 +33,18 @@ const string TEST_CASE = "GRAPH";
 #elif TEST_SORT_TOPO
 #include "unit_test/sort_topo/unit_test.hpp"
 const string TEST_CASE = "SORT_TOPO";
+#elif TEST_LIST
+#include "unit_test/list/unit_test.hpp"
+const string TEST_CASE = "LIST";
+#elif TEST_STACKNQUEUE
+#include "unit_test/stacknqueue/unit_test.hpp"
+const string TEST_CASE = "STACKNQUEUE";
+#elif TEST_HASH
+#include "unit_test/hash/unit_test.hpp"
+const string TEST_CASE = "HASH";
+#elif TEST_HEAP
+#include "unit_test/heap/unit_test.hpp"
+const string TEST_CASE = "HEAP";
 #endif
 void printTestCase();
 
@@ -68,6 +88,54 @@ void handleTestUnit(int argc, char *argv[]) {
     printTestCase();
   }
 }
+#elif TEST_LIST
+void handleTestUnit(int argc, char *argv[]) {
+  UNIT_TEST_List unitTest;
+
+  if (argc == 2 || (argc == 3 && std::string(argv[2]) == "all")) {
+    unitTest.runAllTests();
+  } else if (argc == 3) {
+    unitTest.runTest(argv[2]);
+  } else {
+    printTestCase();
+  }
+}
+#elif TEST_STACKNQUEUE
+void handleTestUnit(int argc, char *argv[]) {
+  UNIT_TEST_StackNQueue unitTest;
+
+  if (argc == 2 || (argc == 3 && std::string(argv[2]) == "all")) {
+    unitTest.runAllTests();
+  } else if (argc == 3) {
+    unitTest.runTest(argv[2]);
+  } else {
+    printTestCase();
+  }
+}
+#elif TEST_HASH
+void handleTestUnit(int argc, char *argv[]) {
+  UNIT_TEST_Hash unitTest;
+
+  if (argc == 2 || (argc == 3 && std::string(argv[2]) == "all")) {
+    unitTest.runAllTests();
+  } else if (argc == 3) {
+    unitTest.runTest(argv[2]);
+  } else {
+    printTestCase();
+  }
+}
+#elif TEST_HEAP
+void handleTestUnit(int argc, char *argv[]) {
+  UNIT_TEST_Heap unitTest;
+
+  if (argc == 2 || (argc == 3 && std::string(argv[2]) == "all")) {
+    unitTest.runAllTests();
+  } else if (argc == 3) {
+    unitTest.runTest(argv[2]);
+  } else {
+    printTestCase();
+  }
+}
 #endif
 
 void printTestCase() {
@@ -0,0 +1,44 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash01() {
+  string name = "hash01";
+  //! data ------------------------------------
+  // 5 keys whose home is the last slot: the run wraps to slots 0..3, and
+  // 2 keys with home 1 are pushed behind it
+  FlatMap<int, int> map(&moduloIntHash);
+  vector<int> last = keysWithHome(15, 16, 5);
+  vector<int> one = keysWithHome(1, 16, 2);
+  for (int idx = 0; idx < 5; idx++) map.put(last[idx], idx);
+  for (int idx = 0; idx < 2; idx++) map.put(one[idx], 10 + idx);
+
+  stringstream output;
+  DLinkedList<int> clashes = map.clashes();
+  output << "capacity=" << map.getCapacity() << "; home15=" << clashes.get(15)
+         << "; home1=" << clashes.get(1);
+
+  // erasing at the end of the table shifts the wrapped keys back across it
+  map.remove(last[0]);
+  map.remove(last[3]);
+  output << "; size=" << map.size() << "; found=";
+  for (int idx = 0; idx < 5; idx++) output << map.containsKey(last[idx]);
+  output << "; values=" << map.get(last[1]) << map.get(last[2])
+         << map.get(last[4]) << " " << map.get(one[0]) << " "
+         << map.get(one[1]);
+
+  // and they are inserted again across the end
+  map.put(last[3], 33);
+  map.put(last[0], 30);
+  output << "; again=" << map.get(last[0]) << " " << map.get(last[3]) << " "
+         << map.get(last[4]) << "; size=" << map.size();
+
+  //! expect ----------------------------------
+  string expect =
+      "capacity=16; home15=5; home1=2; size=5; found=01101; values=124 10 "
+      "11; again=30 33 4; size=7";
+
+  //! remove data -----------------------------
+  map.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
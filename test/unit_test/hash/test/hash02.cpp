@@ -0,0 +1,56 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash02() {
+  string name = "hash02";
+  //! data ------------------------------------
+  // one probe run: keys of homes 3, 4 and 5 interleaved by Robin Hood
+  FlatMap<int, int> map(&moduloIntHash);
+  vector<int> three = keysWithHome(3, 16, 4);
+  vector<int> four = keysWithHome(4, 16, 3);
+  vector<int> five = keysWithHome(5, 16, 3);
+  vector<int> keys;
+  for (int idx = 0; idx < 4; idx++) {
+    if (idx < 3) keys.push_back(five[idx]);
+    if (idx < 3) keys.push_back(four[idx]);
+    keys.push_back(three[idx]);
+  }
+  for (int key : keys) map.put(key, key * 2);
+
+  // erase in the middle of the run, at its start, at its end; after each
+  // erase every other key must still be found and the erased one not
+  int order[] = {4, 0, 9, 2, 7, 5, 1, 8, 3, 6};
+  int misses = 0, ghosts = 0;
+  vector<bool> removed(keys.size(), false);
+  for (int pos : order) {
+    if (map.remove(keys[pos]) != keys[pos] * 2) misses++;
+    removed[pos] = true;
+    for (int idx = 0; idx < (int)keys.size(); idx++) {
+      if (removed[idx] && map.containsKey(keys[idx])) ghosts++;
+      if (!removed[idx] && (!map.containsKey(keys[idx]) ||
+                            map.get(keys[idx]) != keys[idx] * 2))
+        misses++;
+    }
+  }
+  bool thrown = false;
+  try {
+    map.get(keys[0]);
+  } catch (KeyNotFound &e) {
+    thrown = true;
+  }
+  bool removedAgain = map.remove(keys[0], 0);
+
+  //! expect ----------------------------------
+  string expect = "misses=0; ghosts=0; empty=1; thrown=1; removedAgain=0";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << "misses=" << misses << "; ghosts=" << ghosts
+         << "; empty=" << map.empty() << "; thrown=" << thrown
+         << "; removedAgain=" << removedAgain;
+
+  //! remove data -----------------------------
+  map.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash03() {
+  string name = "hash03";
+  //! data ------------------------------------
+  // sumStringHash: all permutations of a word share one hash, so the map
+  // holds long runs of equal control bytes; checked against std::map
+  FlatMap<string, int> map(&sumStringHash);
+  std::map<string, int> model;
+  vector<string> words;
+  for (string word : {"abcde", "vwxyz", "aabbc"}) {
+    sort(word.begin(), word.end());
+    do words.push_back(word);
+    while (next_permutation(word.begin(), word.end()));
+  }
+  mt19937 gen(3);
+  int mismatches = 0;
+  for (int step = 0; step < 20000; step++) {
+    string &key = words[gen() % words.size()];
+    int op = gen() % 3;
+    if (op == 0) {
+      map.put(key, step);
+      model[key] = step;
+    } else if (op == 1) {
+      bool present = model.erase(key) > 0;
+      if (present) map.remove(key);
+      if (map.containsKey(key)) mismatches++;
+    } else {
+      auto it = model.find(key);
+      bool present = it != model.end();
+      if (map.containsKey(key) != present) mismatches++;
+      if (present && map.get(key) != it->second) mismatches++;
+    }
+  }
+  for (auto &entry : model)
+    if (map.get(entry.first) != entry.second) mismatches++;
+
+  // lookups by view hash with sumViewHash, as the string hooks do
+  model["abcde"] = -1;
+  map.put("abcde", -1);
+  string_view view("edcba");
+  bool viewed = map.containsKey("abcde") && map.get("abcde") == -1 &&
+                map.containsKey(view) == (model.count("edcba") > 0);
+
+  //! expect ----------------------------------
+  string expect = "mismatches=0; same size=1; viewed=1";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << "mismatches=" << mismatches
+         << "; same size=" << (map.size() == (int)model.size())
+         << "; viewed=" << viewed;
+
+  //! remove data -----------------------------
+  map.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
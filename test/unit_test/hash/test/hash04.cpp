@@ -0,0 +1,53 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash04() {
+  string name = "hash04";
+  //! data ------------------------------------
+  // enough keys to rehash several times: hashes are rebuilt from ctrl/hashes
+  FlatMap<int, int> map(&mixIntHash);
+  for (int key = 0; key < 1000; key++) map.put(key, key + 1);
+
+  // a copy is independent of the original
+  FlatMap<int, int> copy(map);
+  copy.put(5, -5);
+  copy.remove(6);
+  stringstream output;
+  output << "size=" << map.size() << "/" << copy.size()
+         << "; 5=" << map.get(5) << "/" << copy.get(5)
+         << "; 6=" << map.containsKey(6) << "/" << copy.containsKey(6);
+
+  // moving leaves the source empty but usable
+  FlatMap<int, int> moved(std::move(copy));
+  copy.put(1, 1);
+  FlatMap<int, int> assigned(&mixIntHash);
+  assigned.put(-1, -1);
+  assigned = std::move(moved);
+  output << "; moved=" << moved.size() << " " << copy.size()
+         << "; assigned=" << assigned.size() << " " << assigned.get(999)
+         << " " << assigned.containsKey(-1);
+
+  // copy assignment over a non-empty map, then clear and reuse
+  copy = map;
+  map.clear();
+  output << "; copy=" << copy.size() << " " << copy.get(500)
+         << "; cleared=" << map.size() << " " << map.containsKey(500);
+  map.put(500, 7);
+  output << " " << map.get(500) << " " << map.getCapacity();
+
+  // an owning map deletes its values (checked by the sanitizer)
+  FlatMap<int, int *> owned(&mixIntHash, 0.875f, 0, &FlatMap<int, int *>::freeValue);
+  for (int key = 0; key < 100; key++) owned.put(key, new int(key));
+  output << "; owned=" << *owned.get(99);
+
+  //! expect ----------------------------------
+  string expect =
+      "size=1000/999; 5=6/-5; 6=1/0; moved=0 1; assigned=999 1000 0; "
+      "copy=1000 501; cleared=0 0 7 16; owned=99";
+
+  //! remove data -----------------------------
+  map.clear();
+  owned.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
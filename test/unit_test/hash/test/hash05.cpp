@@ -0,0 +1,81 @@
+#include <map>
+#include <random>
+#include <set>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash05() {
+  string name = "hash05";
+  //! data ------------------------------------
+  // step 1: every operation moves at most one old bucket, so most of the
+  // operations below run with both tables live; checked against std::map
+  xMap<string, int> map(&xMap<string, int>::stringKeyHash);
+  map.setIncrementalRehash(1);
+  std::map<string, int> model;
+  mt19937 gen(5);
+  int mismatches = 0, duringRehash = 0, iterated = 0, copied = 0;
+  for (int step = 0; step < 30000; step++) {
+    string key = "k" + to_string(gen() % (step < 20000 ? 4000 : 200));
+    int op = gen() % 8;
+    if (map.isRehashing()) duringRehash++;
+    if (op <= 2) {
+      map.put(key, step);
+      model[key] = step;
+    } else if (op == 3) {
+      auto it = model.find(key);
+      if (it != model.end()) {
+        if (map.remove(key) != it->second) mismatches++;
+        model.erase(it);
+      } else {
+        try {
+          map.remove(key);
+          mismatches++;
+        } catch (KeyNotFound &e) {
+        }
+      }
+    } else if (op == 4) {
+      // by view: the bucket is looked up in the old table if not moved yet
+      string_view view(key);
+      bool present = model.count(key) > 0;
+      if (map.containsKey(view) != present) mismatches++;
+      if (present && map.get(key.c_str()) != model[key]) mismatches++;
+    } else {
+      auto it = model.find(key);
+      bool present = it != model.end();
+      if (map.containsKey(key) != present) mismatches++;
+      if (present && map.get(key) != it->second) mismatches++;
+    }
+    if (map.size() != (int)model.size()) mismatches++;
+
+    if (step % 97 == 0 && map.isRehashing()) {
+      // iteration visits both tables (and does not finish the rehash)
+      std::map<string, int> seen;
+      for (auto &entry : map) seen[entry.getKey()] = entry.getValue();
+      if (seen != model) mismatches++;
+      iterated += map.isRehashing();
+      // a copy made now holds every entry, and is independent
+      xMap<string, int> copy(map);
+      copy.put("extra", -1);
+      if (copy.size() != (int)model.size() + 1 || map.containsKey("extra"))
+        mismatches++;
+      for (auto &entry : model)
+        if (copy.get(entry.first) != entry.second) mismatches++;
+      copied++;
+    }
+  }
+
+  //! expect ----------------------------------
+  string expect = "mismatches=0; rehashing=1; iterated=1; copied=1";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << "mismatches=" << mismatches
+         << "; rehashing=" << (duringRehash > 2000)
+         << "; iterated=" << (iterated > 10) << "; copied=" << (copied > 10);
+
+  //! remove data -----------------------------
+  map.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,56 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash06() {
+  string name = "hash06";
+  //! data ------------------------------------
+  // clear, keys/values and destruction in the middle of an incremental
+  // rehash; the values are owned by the map (checked by the sanitizer)
+  xMap<int, int *> map(&xMap<int, int *>::intKeyHash, 0.75f, 0,
+                       &xMap<int, int *>::freeValue);
+  map.setPowerOfTwo(true);
+  map.setIncrementalRehash(1);
+  int key = 0;
+  while (key < 100 || !map.isRehashing()) {
+    map.put(key, new int(key));
+    key++;
+  }
+  stringstream output;
+  output << "rehashing=" << map.isRehashing() << "; size=" << (map.size() == key)
+         << "; last=" << *map.get(key - 1);
+
+  // keys() finishes the rehash first
+  DLinkedList<int> keys = map.keys();
+  output << "; keys=" << (keys.size() == key) << "; after=" << map.isRehashing();
+
+  // start another rehash, then clear in the middle of it
+  while (!map.isRehashing()) {
+    map.put(key, new int(key));
+    key++;
+  }
+  map.clear();
+  output << "; cleared=" << map.size() << " " << map.isRehashing() << " "
+         << map.getCapacity() << " " << map.containsKey(0);
+  for (int idx = 0; idx < 10; idx++) map.put(idx, new int(idx));
+  output << "; reused=" << map.size() << " " << *map.get(9);
+
+  // and destroy a map in the middle of one
+  {
+    xMap<int, int *> other(&xMap<int, int *>::intKeyHash, 0.75f, 0,
+                           &xMap<int, int *>::freeValue);
+    other.setIncrementalRehash(2);
+    for (int idx = 0; !other.isRehashing() || idx < 50; idx++)
+      other.put(idx, new int(idx));
+    output << "; other=" << other.isRehashing();
+  }
+
+  //! expect ----------------------------------
+  string expect =
+      "rehashing=1; size=1; last=" + to_string(keys.size() - 1) +
+      "; keys=1; after=0; cleared=0 0 16 0; reused=10 9; other=1";
+
+  //! remove data -----------------------------
+  map.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,52 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash07() {
+  string name = "hash07";
+  //! data ------------------------------------
+  // auto-shrink with incremental rehash: no shrink starts while buckets are
+  // still migrating; once the rehash is done, the next remove shrinks
+  xMap<int, int> map(&xMap<int, int>::intKeyHash);
+  map.setIncrementalRehash(1);
+  map.setShrinkLoad(0.1f);
+  for (int key = 0; key < 3000; key++) map.put(key, -key);
+  map.setIncrementalRehash(0);  // finish the last growth
+  map.setIncrementalRehash(1);
+  int grown = map.getCapacity();
+
+  int mismatches = 0, shrinks = 0, changedWhileMigrating = 0;
+  for (int key = 0; key < 2990; key++) {
+    bool migrating = map.isRehashing();
+    int capacity = map.getCapacity();
+    if (map.remove(key) != -key) mismatches++;
+    if (migrating && map.isRehashing() && map.getCapacity() != capacity)
+      changedWhileMigrating++;
+    if (!migrating && map.isRehashing()) shrinks++;
+    if (key % 50 == 0) {
+      // every key left is still found, in whichever table it is
+      for (int other = key + 1; other < 3000; other++)
+        if (!map.containsKey(other) || map.get(other) != -other) mismatches++;
+      if (map.containsKey(key)) mismatches++;
+    }
+  }
+  for (int key = 2990; key < 3000; key++)
+    if (map.get(key) != -key) mismatches++;
+  map.setIncrementalRehash(0);
+
+  //! expect ----------------------------------
+  string expect =
+      "mismatches=0; shrinks>1=1; changedWhileMigrating=0; size=10; "
+      "smaller=1";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << "mismatches=" << mismatches << "; shrinks>1=" << (shrinks > 1)
+         << "; changedWhileMigrating=" << changedWhileMigrating
+         << "; size=" << map.size()
+         << "; smaller=" << (map.getCapacity() * 10 < grown);
+
+  //! remove data -----------------------------
+  map.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,41 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash08() {
+  string name = "hash08";
+  //! data ------------------------------------
+  // every remove overload decrements size(); a failed remove does not
+  xMap<string, int> map(&xMap<string, int>::stringKeyHash);
+  for (int idx = 0; idx < 20; idx++) map.put("k" + to_string(idx), idx);
+  map.put("k0", 100);  // an update is not a new key
+
+  stringstream output;
+  output << map.size();
+  map.remove("k1");  // by view
+  output << " " << map.size();
+  map.remove(string("k2"));  // by key
+  output << " " << map.size();
+  output << " " << map.remove(string("k3"), 3);  // by key and value
+  output << " " << map.size();
+  output << " " << map.remove(string("k4"), -4);  // wrong value: kept
+  output << " " << map.size();
+  try {
+    map.remove(string("k2"));
+  } catch (KeyNotFound &e) {
+    output << " thrown";
+  }
+  output << " " << map.size();
+  for (int idx = 4; idx < 20; idx++) map.remove("k" + to_string(idx));
+  output << " " << map.size() << " " << map.empty() << " "
+         << map.keys().toString();
+  map.remove("k0");
+  output << " " << map.size() << " " << map.empty();
+
+  //! expect ----------------------------------
+  string expect = "20 19 18 1 17 0 17 thrown 17 1 0 [k0] 0 1";
+
+  //! remove data -----------------------------
+  map.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
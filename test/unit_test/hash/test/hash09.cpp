@@ -0,0 +1,39 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash09() {
+  string name = "hash09";
+  //! data ------------------------------------
+  // find: the value by key or by view, 0 when absent; also while rehashing
+  xMap<string, int> map(&xMap<string, int>::stringKeyHash);
+  map.setIncrementalRehash(1);
+  for (int idx = 0; idx < 100; idx++) map.put("k" + to_string(idx), idx);
+
+  stringstream output;
+  int *value = map.find(string("k7"));  // by key
+  output << (value != 0 ? *value : -1);
+  value = map.find("k8");  // by view
+  output << " " << (value != 0 ? *value : -1);
+  *value = 800;  // written through the pointer
+  output << " " << map.get("k8");
+  output << " " << (map.find(string("k100")) == 0) << " "
+         << (map.find("k100") == 0);
+
+  int found = 0, wrong = 0, rehashing = 0;
+  for (int idx = 0; idx < 100; idx++) {
+    if (map.isRehashing()) rehashing++;
+    value = map.find("k" + to_string(idx));
+    if (value == 0) continue;
+    found++;
+    if (*value != (idx == 8 ? 800 : idx)) wrong++;
+  }
+  output << " " << found << " " << wrong << " " << (rehashing > 0);
+
+  //! expect ----------------------------------
+  string expect = "7 8 800 1 1 100 0 1";
+
+  //! remove data -----------------------------
+  map.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
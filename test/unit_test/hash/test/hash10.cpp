@@ -0,0 +1,117 @@
+#include <unistd.h>
+
+#include <fstream>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash10() {
+  string name = "hash10";
+  //! data ------------------------------------
+  // FrozenMap: freeze a string->int and an int->double map into temp files,
+  // reopen them and look up by string, string_view and const char*; then the
+  // files it must refuse: another V, a truncated image, a missing file and a
+  // slot table without an EMPTY slot
+  string base = "/tmp/hash10_" + to_string(getpid());
+  string words = base + "_words.map", numbers = base + "_numbers.map",
+         none = base + "_empty.map", broken = base + "_broken.map";
+
+  xMap<string, int> vocab(&xMap<string, int>::stringKeyHash);
+  for (int idx = 0; idx < 1000; idx++) vocab.put("w" + to_string(idx), idx);
+  vocab.put("", -1);  // the empty key is a key
+  FrozenMap<string, int>::freeze(vocab, words);
+  xMap<int, double> squares(&xMap<int, double>::intKeyHash);
+  for (int idx = -50; idx < 50; idx++) squares.put(idx, idx * 0.5);
+  FrozenMap<int, double>::freeze(squares, numbers);
+  xMap<string, int> nothing(&xMap<string, int>::stringKeyHash);
+  FrozenMap<string, int>::freeze(nothing, none);
+
+  stringstream output;
+  {
+    FrozenMap<string, int> frozen(words);
+    string key = "w7";
+    string_view view = "w123-suffix";
+    view = view.substr(0, 4);
+    int missing = 0, wrong = 0;
+    for (int idx = 0; idx < 1000; idx++) {
+      const int *value = frozen.find("w" + to_string(idx));
+      if (value == 0) missing++;
+      else if (*value != idx) wrong++;
+    }
+    output << frozen.size() << " " << missing << wrong << " "
+           << frozen.get(key) << " " << frozen.get(view) << " "
+           << frozen.get("w999") << " " << frozen.get("") << " "
+           << frozen.containsKey("w1000") << frozen.containsKey(string("w1"))
+           << frozen.containsKey(string_view("w10"));
+    try {
+      frozen.get("w1000");
+    } catch (KeyNotFound &e) {
+      output << " " << e.what();
+    }
+  }
+  {
+    FrozenMap<int, double> frozen(numbers);
+    output << "; " << frozen.size() << " " << frozen.get(-50) << " "
+           << frozen.get(49) << " " << frozen.containsKey(50)
+           << frozen.containsKey(0);
+    try {
+      frozen.get(50);
+    } catch (KeyNotFound &e) {
+      output << " " << e.what();
+    }
+  }
+  {
+    FrozenMap<string, int> frozen(none);
+    output << "; " << frozen.size() << frozen.empty()
+           << frozen.containsKey("w1");
+  }
+
+  auto refused = [&](string filename, auto open) {
+    try {
+      open(filename);
+    } catch (runtime_error &e) {
+      string message = e.what();
+      size_t at = message.find(filename);
+      if (at != string::npos) message.replace(at, filename.length(), "F");
+      output << "; " << message;
+      return;
+    }
+    output << "; opened";
+  };
+  refused(words, [](string filename) { FrozenMap<string, long> frozen(filename); });
+  refused(numbers, [](string filename) { FrozenMap<long, double> frozen(filename); });
+  {
+    ifstream in(words, ios::binary);
+    string image((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    ofstream(broken, ios::binary | ios::trunc) << image.substr(0, image.size() / 2);
+    refused(broken, [](string filename) { FrozenMap<string, int> frozen(filename); });
+    ofstream(broken, ios::binary | ios::trunc) << image.substr(0, 10);
+    refused(broken, [](string filename) { FrozenMap<string, int> frozen(filename); });
+    // every slot taken: a miss would probe forever
+    FrozenMapHeader header;
+    memcpy(&header, image.data(), sizeof(header));
+    header.count = header.slotCount;
+    image.replace(0, sizeof(header), (const char *)&header, sizeof(header));
+    ofstream(broken, ios::binary | ios::trunc) << image;
+    refused(broken, [](string filename) { FrozenMap<string, int> frozen(filename); });
+  }
+  unlink(broken.c_str());
+  refused(broken, [](string filename) { FrozenMap<string, int> frozen(filename); });
+
+  //! expect ----------------------------------
+  string expect =
+      "1001 00 7 123 999 -1 011 key (w1000) is not found; 100 -25 24.5 01 key "
+      "(50) is not found; 010; FrozenMap: F is not a frozen map of these types; "
+      "FrozenMap: F is not a frozen map of these types; FrozenMap: F is not a "
+      "frozen map of these types; FrozenMap: F is not a frozen map; FrozenMap: F "
+      "is not a frozen map of these types; FrozenMap: cannot open F";
+
+  //! remove data -----------------------------
+  unlink(words.c_str());
+  unlink(numbers.c_str());
+  unlink(none.c_str());
+  vocab.clear();
+  squares.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
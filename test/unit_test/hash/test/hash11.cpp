@@ -0,0 +1,86 @@
+#include <atomic>
+#include <set>
+#include <thread>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash11() {
+  string name = "hash11";
+  //! data ------------------------------------
+  // ConcurrentMap: writers put and remove overlapping keys 0..999 (the value
+  // of key is always 10*key), readers tryGet them, and every thread calls
+  // compute_if_absent on keys 1000..1999: mapping must run once per key.
+  // Once the threads are joined, size(), keys() and snapshot() agree
+  ConcurrentMap<int, int> map(&xMap<int, int>::intKeyHash, 0.75f, 0, 0, 0, 0, 8);
+  atomic<int> mappings(0), badReads(0), badComputes(0), removes(0);
+  auto writer = [&](int seed) {
+    for (int round = 0; round < 5000; round++) {
+      int key = (round * 7 + seed * 131) % 1000;
+      if (round % 3 == 2) {
+        try {
+          if (map.remove(key) != 10 * key) badReads++;
+          removes++;
+        } catch (KeyNotFound &e) {
+        }
+      } else {
+        map.put(key, 10 * key);
+      }
+    }
+  };
+  auto reader = [&](int seed) {
+    for (int round = 0; round < 5000; round++) {
+      int key = (round * 13 + seed * 71) % 1000, value;
+      if (map.tryGet(key, value) && value != 10 * key) badReads++;
+    }
+  };
+  auto computer = [&](int seed) {
+    for (int idx = 0; idx < 1000; idx++) {
+      int key = 1000 + (idx + seed * 250) % 1000;
+      int value = map.compute_if_absent(key, [&](const int &key) {
+        mappings++;
+        return 10 * key;
+      });
+      if (value != 10 * key) badComputes++;
+    }
+  };
+  vector<thread> threads;
+  for (int seed = 0; seed < 4; seed++) {
+    threads.push_back(thread(writer, seed));
+    threads.push_back(thread(reader, seed));
+    threads.push_back(thread(computer, seed));
+  }
+  for (thread &worker : threads) worker.join();
+
+  stringstream output;
+  output << mappings << " " << badComputes << " " << badReads << " "
+         << (removes > 0);
+
+  DLinkedList<int> keys = map.keys();
+  ConcurrentMap<int, int>::Snapshot snapshot = map.snapshot();
+  set<int> unique;
+  int wrongValues = 0, notInSnapshot = 0;
+  for (int key : keys) {
+    unique.insert(key);
+    if (map.get(key) != 10 * key) wrongValues++;
+    if (!snapshot.containsKey(key) || snapshot.get(key) != 10 * key)
+      notInSnapshot++;
+  }
+  output << "; " << (map.size() == keys.size()) << (map.size() == snapshot.size())
+         << ((int)unique.size() == map.size()) << " " << wrongValues
+         << notInSnapshot << " " << (map.size() >= 1000);
+  for (int key = 1000; key < 2000; key++)
+    if (!unique.count(key)) notInSnapshot++;
+  output << notInSnapshot;
+
+  // the snapshot is a copy: later writes do not reach it
+  map.clear();
+  output << " " << map.size() << map.empty() << " " << (snapshot.size() >= 1000);
+
+  //! expect ----------------------------------
+  string expect = "1000 0 0 1; 111 00 10 01 1";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,68 @@
+#include "../unit_test.hpp"
+
+int hash12ModuloHash(int &key, int tableSize) { return key % tableSize; }
+
+bool UNIT_TEST_Hash::hash12() {
+  string name = "hash12";
+  //! data ------------------------------------
+  // stats: with key % capacity as the hash the buckets are known, so every
+  // counter is too: 0, 10, 20 share bucket 0 (2 collisions), a lookup of 20
+  // compares 3 keys; the 8th key rehashes 10 -> 15 buckets. toJSON is checked
+  // whole, with the clock and the byte count (platform-dependent) zeroed
+  xMap<int, int> map(&hash12ModuloHash);
+  map.enableStats();
+  for (int key : {0, 10, 20, 1, 2}) map.put(key, key);
+  map.put(10, 100);   // an update: 2 probes, no collision
+  map.get(20);        // 3 probes
+  map.containsKey(5); // an empty bucket: 0 probes
+  try {
+    map.get(30);      // 3 probes, not found
+  } catch (KeyNotFound &e) {
+  }
+  map.remove(0);      // 1 probe
+  for (int key : {3, 4, 5, 6}) map.put(key, key);  // 6: count 8 > 7.5
+
+  stringstream output;
+  HashMapStats stats = map.getStats();
+  output << stats.operations() << " " << stats.probes << " " << stats.maxProbe
+         << " " << stats.collisions << " " << stats.rehashes << " "
+         << (stats.bytes > 0) << " " << (stats.rehashMillis >= 0);
+  stats.bytes = 0;
+  stats.rehashMillis = 0;
+  output << " " << stats.toJSON();
+
+  map.resetStats();  // counters only: size, capacity, histogram are measured
+  stats = map.getStats();
+  output << "; " << stats.operations() << stats.probes << stats.maxProbe
+         << stats.collisions << stats.rehashes << stats.loadHistory.size()
+         << " " << stats.count << " " << stats.capacity << " "
+         << stats.bucketHistogram[2];
+  map.get(20);
+  output << " " << map.getStats().lookups << map.getStats().probes;
+
+  xMap<int, int> copy(map);  // starts with the stats off
+  copy.get(20);
+  copy.put(7, 7);
+  stats = copy.getStats();
+  output << "; " << stats.operations() << stats.probes << " " << stats.count;
+  map.enableStats(false);
+  map.get(20);
+  output << " " << map.getStats().lookups;
+
+  //! expect ----------------------------------
+  string expect =
+      "14 12 3 2 1 1 1 {\"count\": 8, \"capacity\": 15, \"loadFactor\": "
+      "0.533333, \"bytes\": 0, \"puts\": 10, \"lookups\": 3, \"removes\": 1, "
+      "\"probes\": 12, \"meanProbe\": 0.857143, \"maxProbe\": 3, "
+      "\"collisions\": 2, \"rehashes\": 1, \"rehashMillis\": 0, "
+      "\"bucketHistogram\": [8, 6, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0], "
+      "\"loadHistory\": [{\"operation\": 14, \"count\": 8, \"capacity\": 10, "
+      "\"newCapacity\": 15}]}; 000000 8 15 1 11; 00 9 0";
+
+  //! remove data -----------------------------
+  copy.clear();
+  map.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,69 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Hash::hash13() {
+  string name = "hash13";
+  //! data ------------------------------------
+  // reserve(n) then n puts: no rehash; shrink_to_fit after removing most
+  // keys: back to the smallest capacity that holds the rest, all readable;
+  // both also while an incremental rehash is in progress (they finish it)
+  stringstream output;
+  for (bool powerOfTwo : {false, true}) {
+    xMap<string, int> map(&xMap<string, int>::stringKeyHash);
+    map.setPowerOfTwo(powerOfTwo);
+    map.enableStats();
+    map.reserve(1000);
+    int reserved = map.getCapacity();
+    for (int idx = 0; idx < 1000; idx++) map.put("k" + to_string(idx), idx);
+    output << (map.getCapacity() == reserved) << map.getStats().rehashes;
+    map.reserve(10);  // never shrinks
+    output << (map.getCapacity() == reserved);
+
+    for (int idx = 5; idx < 1000; idx++) map.remove("k" + to_string(idx));
+    map.shrink_to_fit();
+    int wrong = 0;
+    for (int idx = 0; idx < 5; idx++)
+      if (map.get("k" + to_string(idx)) != idx) wrong++;
+    output << " " << map.getCapacity() << " " << map.size() << wrong << "; ";
+    map.clear();
+  }
+
+  xMap<string, int> map(&xMap<string, int>::stringKeyHash);
+  map.setIncrementalRehash(1);
+  int next = 0;
+  while (!map.isRehashing()) {
+    map.put("k" + to_string(next), next);
+    next++;
+  }
+  map.reserve(5000);  // finishes the rehash, then rehashes all at once
+  int reserved = map.getCapacity();
+  output << map.isRehashing() << (reserved >= 5000 / 0.75);
+  for (; next < 5000; next++) map.put("k" + to_string(next), next);
+  output << (map.getCapacity() == reserved) << map.isRehashing();
+
+  for (int idx = 20; idx < 5000; idx++) map.remove("k" + to_string(idx));
+  map.setIncrementalRehash(0);
+  map.shrink_to_fit();  // 20 keys: 27 buckets
+  map.setIncrementalRehash(1);
+  while (!map.isRehashing()) {
+    map.put("k" + to_string(next), next);
+    next++;
+  }
+  int during = map.size();
+  for (int idx = 5000; idx < next; idx++) map.remove("k" + to_string(idx));
+  output << " " << map.isRehashing() << (during > 20);
+  map.shrink_to_fit();
+  int wrong = 0;
+  for (int idx = 0; idx < 20; idx++)
+    if (map.get("k" + to_string(idx)) != idx) wrong++;
+  output << " " << map.isRehashing() << " " << map.getCapacity() << " "
+         << map.size() << wrong;
+
+  //! expect ----------------------------------
+  string expect = "111 10 50; 111 16 50; 0110 11 0 27 200";
+
+  //! remove data -----------------------------
+  map.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,94 @@
+#include "../unit_test.hpp"
+#include <climits>
+
+bool UNIT_TEST_Hash::hash14() {
+  string name = "hash14";
+  //! data ------------------------------------
+  // published values: wyhash final 4 test vectors (seed = index), 64-bit
+  // FNV-1a, murmur3 fmix64/fmix32; then every hook lands in [0, size) for
+  // negative ints, INT_MIN, non-ASCII bytes and sizes 1, odd, powers of two;
+  // the view hooks agree with the string hooks
+  stringstream output;
+  const char *vectors[] = {
+      "",
+      "a",
+      "abc",
+      "message digest",
+      "abcdefghijklmnopqrstuvwxyz",
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+      "1234567890123456789012345678901234567890"
+      "1234567890123456789012345678901234567890"};
+  output << hex;
+  for (int idx = 0; idx < 7; idx++)
+    output << wyhashBytes(vectors[idx], strlen(vectors[idx]), idx) << " ";
+  output << fnv1aBytes("", 0) << " " << fnv1aBytes("a", 1) << " "
+         << fnv1aBytes("foobar", 6) << " " << hashMix64(0) << " "
+         << hashMix64(1) << " " << hashMix32(0) << " " << hashMix32(1);
+  output << dec << "; ";
+
+  vector<string> keys = {"", "a", "FC_1_W", "FC_1_b", "\xff\xfe\x80",
+                         string(100, '\xff'), string(3, '\0')};
+  for (int idx = 0; idx < 200; idx++) keys.push_back("k" + to_string(idx));
+  vector<int> ints = {0, 1, -1, INT_MIN, INT_MAX, INT_MIN + 1};
+  for (int idx = -100; idx < 100; idx++) ints.push_back(idx * 7919);
+  int sizes[] = {1, 2, 3, 7, 10, 16, 1000, 1 << 20, INT_MAX};
+
+  int (*stringHooks[])(string &, int) = {&wyStringHash, &fnv1aStringHash,
+                                         &sumStringHash,
+                                         &xMap<string, int>::stringKeyHash};
+  int (*viewHooks[])(string_view, int) = {&wyViewHash, &fnv1aViewHash,
+                                          &sumViewHash, &wyViewHash};
+  for (int hook = 0; hook < 4; hook++) {
+    int outside = 0, disagree = 0;
+    for (int size : sizes)
+      for (string &key : keys) {
+        int index = stringHooks[hook](key, size);
+        if (index < 0 || index >= size) outside++;
+        if (viewHooks[hook](key, size) != index) disagree++;
+      }
+    output << outside << disagree << " ";
+  }
+  int (*intHooks[])(int &, int) = {&mixIntHash, &xMap<int, int>::intKeyHash};
+  for (auto hook : intHooks) {
+    int outside = 0;
+    for (int size : sizes)
+      for (int key : ints) {
+        int index = hook(key, size);
+        if (index < 0 || index >= size) outside++;
+      }
+    output << outside << " ";
+  }
+  int outside = 0;  // moduloIntHash: keys must be >= 0
+  for (int size : sizes)
+    for (int key : ints) {
+      if (key < 0) continue;
+      int index = moduloIntHash(key, size);
+      if (index < 0 || index >= size) outside++;
+    }
+  output << outside << "; ";
+
+  // sequential and strided ints still spread over a table of 1000
+  for (int stride : {1, 1000}) {
+    vector<bool> used(1000, false);
+    int buckets = 0;
+    for (int idx = 0; idx < 1000; idx++) {
+      int key = idx * stride;
+      int index = mixIntHash(key, 1000);
+      if (!used[index]) buckets++;
+      used[index] = true;
+    }
+    output << (buckets > 550);
+  }
+
+  //! expect ----------------------------------
+  string expect =
+      "93228a4de0eec5a2 c5bac3db178713c4 a97f2f7b1d9b3314 786d1f1df3801df4 "
+      "dca5a8138ad37c87 b9e734f117cfaf70 6cc5eab49a92d617 cbf29ce484222325 "
+      "af63dc4c8601ec8c 85944171f73967e8 0 b456bcfc34c2cb2c 0 514e28b7; "
+      "00 00 00 00 0 0 0; 11";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,125 @@
+#ifndef UNIT_TEST_Hash_HPP
+#define UNIT_TEST_Hash_HPP
+
+#include "hash/ConcurrentMap.h"
+#include "hash/FlatMap.h"
+#include "hash/FrozenMap.h"
+#include "hash/xMap.h"
+#include "library.hpp"
+
+/*
+ * keysWithHome(home, capacity, n): n int keys (> 0) that a FlatMap with
+ *  moduloIntHash and this capacity places at "home" (or after it, in a run)
+ */
+inline vector<int> keysWithHome(int home, int capacity, int n) {
+  vector<int> keys;
+  for (int key = 1; (int)keys.size() < n; key++) {
+    uint32_t hash = (uint32_t)hashMix64((uint64_t)(uint32_t)key);
+    if ((int)(hash & (uint32_t)(capacity - 1)) == home) keys.push_back(key);
+  }
+  return keys;
+}
+class UNIT_TEST_Hash {
+ public:
+  UNIT_TEST_Hash() {
+    // TODO unit test new
+    registerTest("hash01", &UNIT_TEST_Hash::hash01);
+    registerTest("hash02", &UNIT_TEST_Hash::hash02);
+    registerTest("hash03", &UNIT_TEST_Hash::hash03);
+    registerTest("hash04", &UNIT_TEST_Hash::hash04);
+    registerTest("hash05", &UNIT_TEST_Hash::hash05);
+    registerTest("hash06", &UNIT_TEST_Hash::hash06);
+    registerTest("hash07", &UNIT_TEST_Hash::hash07);
+    registerTest("hash08", &UNIT_TEST_Hash::hash08);
+    registerTest("hash09", &UNIT_TEST_Hash::hash09);
+    registerTest("hash10", &UNIT_TEST_Hash::hash10);
+    registerTest("hash11", &UNIT_TEST_Hash::hash11);
+    registerTest("hash12", &UNIT_TEST_Hash::hash12);
+    registerTest("hash13", &UNIT_TEST_Hash::hash13);
+    registerTest("hash14", &UNIT_TEST_Hash::hash14);
+  }
+
+ private:
+  // TODO unit test new
+  bool hash01();
+  bool hash02();
+  bool hash03();
+  bool hash04();
+  bool hash05();
+  bool hash06();
+  bool hash07();
+  bool hash08();
+  bool hash09();
+  bool hash10();
+  bool hash11();
+  bool hash12();
+  bool hash13();
+  bool hash14();
+
+ public:
+  static map<string, bool (UNIT_TEST_Hash::*)()> TESTS;
+  // ANSI escape codes for colors
+  const string green = "\033[32m";
+  const string red = "\033[31m";
+  const string cyan = "\033[36m";
+  const string reset = "\033[0m";  // To reset to default color
+
+  // print result test case
+  bool printResult(string output, string expect, string name) {
+    if (expect == output) {
+      cout << green << "test " + name + " --------------- PASS" << reset
+           << "\n";
+      return true;
+    } else {
+      cout << red << "test " + name + " --------------- FAIL" << reset << "\n";
+      cout << "\texpect : " << expect << endl;
+      cout << "\toutput : " << output << endl;
+      return false;
+    }
+  }
+  // run 1 test case
+  void runTest(const std::string &name) {
+    auto it = TESTS.find(name);
+    if (it != TESTS.end()) {
+      (this->*(it->second))();
+    } else {
+      throw std::runtime_error("Test with name '" + name + "' does not exist.");
+    }
+  }
+  // run all test case
+  void runAllTests() {
+    vector<string> fails;
+    for (const auto &test : TESTS) {
+      if (!(this->*(test.second))()) {
+        fails.push_back(test.first);
+      }
+    }
+
+    cout << cyan << "\nResult -------------------------" << reset << endl;
+    // Print the results
+    if (fails.empty()) {
+      cout << green << "All tests passed!" << reset << endl;
+    } else {
+      int totalTests = TESTS.size();
+      int failedTests = fails.size();
+      int passedTests = totalTests - failedTests;
+      double passRate =
+          (totalTests > 0)
+              ? (static_cast<double>(passedTests) / totalTests) * 100.0
+              : 0.0;
+      cout << red << "Some tests failed:";
+      for (const auto &fail : fails) {
+        cout << "  " << fail;
+      }
+      cout << cyan << "\nPass rate: " << passRate << "%" << reset << endl;
+    }
+  }
+  static void registerTest(string name, bool (UNIT_TEST_Hash::*function)()) {
+    if (TESTS.find(name) != TESTS.end()) {
+      throw std::runtime_error("Test with name '" + name + "' already exists.");
+    }
+    TESTS[name] = function;
+  }
+};
+
+#endif  // UNIT_TEST_Hash_HPP
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+
+#include "../unit_test.hpp"
+
+int heap01MaxComparator(int &lhs, int &rhs) {
+  return lhs > rhs ? -1 : (lhs < rhs ? +1 : 0);
+}
+
+bool UNIT_TEST_Heap::heap01() {
+  string name = "heap01";
+  //! data ------------------------------------
+  // pop order: ascending with the default order, descending with a max
+  // comparator; duplicates included; pop/peek on an empty heap throw
+  mt19937 gen(21);
+  vector<int> items(500);
+  for (int &item : items) item = gen() % 100;
+  Heap<int> minHeap;
+  Heap<int> maxHeap(&heap01MaxComparator);
+  for (int item : items) {
+    minHeap.push(item);
+    maxHeap.push(item);
+  }
+
+  stringstream output;
+  vector<int> ascending, descending;
+  while (!minHeap.empty()) ascending.push_back(minHeap.pop());
+  while (!maxHeap.empty()) descending.push_back(maxHeap.pop());
+  vector<int> sorted = items;
+  sort(sorted.begin(), sorted.end());
+  output << (ascending == sorted);
+  sort(sorted.begin(), sorted.end(), greater<int>());
+  output << " " << (descending == sorted);
+
+  try {
+    minHeap.pop();
+  } catch (underflow_error &e) {
+    output << " " << e.what();
+  }
+  try {
+    minHeap.peek();
+  } catch (underflow_error &e) {
+    output << " " << e.what();
+  }
+
+  //! expect ----------------------------------
+  string expect =
+      "1 1 Calling to pop with the empty heap. Calling to peek with the empty "
+      "heap.";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,50 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Heap::heap02() {
+  string name = "heap02";
+  //! data ------------------------------------
+  // remove from the middle: the last item takes the hole and must move up
+  // (it is smaller than the hole's parent) or down (larger than a child);
+  // pushed in level order, the arrays below are the heaps themselves
+  int up[] = {1, 10, 2, 11, 12, 3, 4};
+  int down[] = {1, 2, 10, 3, 4, 11, 12};
+  Heap<int> upHeap, downHeap;
+  IndexedHeap<int> upIndexed, downIndexed;
+  int upHandle = -1, downHandle = -1;
+  for (int idx = 0; idx < 7; idx++) {
+    upHeap.push(up[idx]);
+    downHeap.push(down[idx]);
+    int handle = upIndexed.insert(up[idx]);
+    if (up[idx] == 11) upHandle = handle;
+    handle = downIndexed.insert(down[idx]);
+    if (down[idx] == 10) downHandle = handle;
+  }
+
+  stringstream output;
+  upHeap.remove(11);      // 4 goes up, above 10
+  downHeap.remove(10);    // 12 goes down, below 11
+  upIndexed.erase(upHandle);
+  downIndexed.erase(downHandle);
+  output << upHeap.toString() << " " << downHeap.toString() << " "
+         << upIndexed.toString() << " " << downIndexed.toString();
+
+  output << " ";
+  while (!upHeap.empty()) output << upHeap.pop();
+  output << " ";
+  while (!downIndexed.empty()) output << downIndexed.pop();
+
+  // removing the last item and an absent one
+  downHeap.remove(12);
+  downHeap.remove(99);
+  output << " " << downHeap.toString();
+
+  //! expect ----------------------------------
+  string expect =
+      "[1,4,2,10,12,3] [1,2,11,3,4,12] [1,4,2,10,12,3] [1,2,11,3,4,12] "
+      "12341012 12341112 [1,2,11,3,4]";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
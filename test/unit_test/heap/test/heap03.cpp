@@ -0,0 +1,76 @@
+#include <random>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Heap::heap03() {
+  string name = "heap03";
+  //! data ------------------------------------
+  // handles stay attached to their items whatever swaps reheapUp/reheapDown
+  // do: random inserts, updates and erases checked against a model
+  // (model[handle]: the key, used only while inHeap[handle])
+  mt19937 gen(3);
+  IndexedHeap<int> heap;
+  vector<int> model;
+  vector<bool> inHeap;
+  int wrongGet = 0, wrongContains = 0, wrongTop = 0;
+  for (int step = 0; step < 20000; step++) {
+    int op = gen() % 6;
+    int handle = model.empty() ? -1 : (int)(gen() % model.size());
+    bool present = handle != -1 && inHeap[handle];
+    if (op <= 1 || !present) {
+      int key = gen() % 1000;
+      handle = heap.insert(key);
+      if (handle >= (int)model.size()) {
+        model.resize(handle + 1);
+        inHeap.resize(handle + 1, false);
+      }
+      if (inHeap[handle]) wrongContains++;  // reused while in the heap
+      model[handle] = key;
+      inHeap[handle] = true;
+    } else if (op == 2) {
+      int key = model[handle] - (int)(gen() % 50);
+      heap.decreaseKey(handle, key);
+      model[handle] = key;
+    } else if (op == 3) {
+      int key = model[handle] + (int)(gen() % 50);
+      heap.increaseKey(handle, key);
+      model[handle] = key;
+    } else if (op == 4) {
+      int key = gen() % 1000;
+      heap.update(handle, key);
+      model[handle] = key;
+    } else {
+      if (heap.erase(handle) != model[handle]) wrongGet++;
+      inHeap[handle] = false;
+    }
+
+    if (step % 100 == 0) {
+      for (int idx = 0; idx < (int)model.size(); idx++) {
+        if (heap.containsHandle(idx) != inHeap[idx]) wrongContains++;
+        else if (inHeap[idx] && heap.get(idx) != model[idx]) wrongGet++;
+      }
+    }
+    if (!heap.empty() && model[heap.peekHandle()] != heap.peek()) wrongTop++;
+  }
+
+  stringstream output;
+  output << wrongGet << " " << wrongContains << " " << wrongTop;
+  // draining: each pop gives the smallest key; its handle leaves the heap
+  int last = -1000000, unordered = 0;
+  while (!heap.empty()) {
+    int handle = heap.peekHandle();
+    int key = heap.pop();
+    if (key < last || key != model[handle] || heap.containsHandle(handle))
+      unordered++;
+    last = key;
+  }
+  output << " " << unordered << " " << heap.size();
+
+  //! expect ----------------------------------
+  string expect = "0 0 0 0 0";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,53 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Heap::heap04() {
+  string name = "heap04";
+  //! data ------------------------------------
+  // the handles of erased or popped items are given to the next inserts;
+  // until then, using them throws out_of_range
+  IndexedHeap<int> heap;
+  int a = heap.insert(30);
+  int b = heap.insert(10);
+  int c = heap.insert(20);
+
+  stringstream output;
+  output << a << b << c;
+  output << " " << heap.erase(b) << " " << heap.containsHandle(b);
+  try {
+    heap.get(b);
+  } catch (out_of_range &e) {
+    output << " " << e.what();
+  }
+  try {
+    heap.erase(b);
+  } catch (out_of_range &e) {
+    output << " thrown";
+  }
+  try {
+    heap.decreaseKey(42, 0);
+  } catch (out_of_range &e) {
+    output << " thrown";
+  }
+
+  int d = heap.insert(5);  // takes b's handle
+  output << " " << d << " " << heap.get(d) << " " << heap.peekHandle();
+  output << " " << heap.pop();  // 5: d is free again
+  int e = heap.insert(40);
+  int f = heap.insert(50);  // a new one
+  output << " " << e << " " << f << " " << heap.get(a) << heap.get(c)
+         << heap.get(e) << heap.get(f);
+
+  heap.clear();  // every handle is free, numbering restarts
+  output << " " << heap.containsHandle(a) << " " << heap.insert(1);
+
+  //! expect ----------------------------------
+  string expect =
+      "012 10 0 Handle is not in the heap! thrown thrown 1 5 1 5 1 3 "
+      "30204050 0 0";
+
+  //! remove data -----------------------------
+  heap.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
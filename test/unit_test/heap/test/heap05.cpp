@@ -0,0 +1,51 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Heap::heap05() {
+  string name = "heap05";
+  //! data ------------------------------------
+  // decreaseKey only moves an item towards the top, increaseKey only away
+  // from it: the wrong direction throws invalid_argument and changes nothing;
+  // an equal item is accepted by both; update goes either way
+  IndexedHeap<int> heap;
+  vector<int> handles;
+  for (int key = 10; key <= 70; key += 10) handles.push_back(heap.insert(key));
+  string before = heap.toString();
+
+  stringstream output;
+  try {
+    heap.decreaseKey(handles[3], 45);
+  } catch (invalid_argument &e) {
+    output << e.what();
+  }
+  try {
+    heap.increaseKey(handles[3], 35);
+  } catch (invalid_argument &e) {
+    output << "; " << e.what();
+  }
+  output << "; " << (heap.toString() == before) << heap.get(handles[3]);
+
+  heap.decreaseKey(handles[3], 40);  // equal: no move
+  heap.increaseKey(handles[3], 40);
+  output << " " << (heap.toString() == before);
+
+  heap.decreaseKey(handles[6], 5);   // the last item becomes the top
+  heap.increaseKey(handles[0], 65);  // the top sinks
+  output << " " << heap.peekHandle() << " " << heap.peek();
+  heap.update(handles[1], 1);    // up
+  heap.update(handles[1], 100);  // down
+  heap.update(handles[2], 30);   // unchanged
+  output << " " << heap.peek();
+
+  output << " ";
+  while (!heap.empty()) output << heap.pop() << ",";
+
+  //! expect ----------------------------------
+  string expect =
+      "decreaseKey: the new item is after the current one; increaseKey: the "
+      "new item is before the current one; 140 1 6 5 5 5,30,40,50,60,65,100,";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
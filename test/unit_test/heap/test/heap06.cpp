@@ -0,0 +1,54 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Heap::heap06() {
+  string name = "heap06";
+  //! data ------------------------------------
+  // with the itemId hook, the id of an item is its handle: contains and
+  // remove look it up by id, a second item with the same id or a negative
+  // id is refused
+  IndexedHeap<HeapItem> heap(0, &heapItemId);
+  heap.push(HeapItem{50, 7});
+  heap.push(HeapItem{20, 3});
+  int handle = heap.insert(HeapItem{30, 12});
+
+  stringstream output;
+  output << handle << " " << heap.peekHandle() << " "
+         << heap.containsHandle(7) << heap.containsHandle(4)
+         << heap.containsHandle(100);
+  // == compares the ids: the key does not matter to contains/remove
+  output << " " << heap.contains(HeapItem{0, 12}) << heap.contains(HeapItem{30, 5});
+  try {
+    heap.push(HeapItem{1, 3});
+  } catch (invalid_argument &e) {
+    output << " " << e.what();
+  }
+  try {
+    heap.push(HeapItem{1, -1});
+  } catch (invalid_argument &e) {
+    output << "; " << e.what();
+  }
+
+  heap.decreaseKey(7, HeapItem{10, 7});  // by id
+  output << "; " << heap.peek();
+  heap.remove(HeapItem{0, 7});
+  heap.remove(HeapItem{0, 5});  // absent: nothing
+  output << " " << heap.size() << heap.containsHandle(7);
+  heap.push(HeapItem{5, 7});  // the id is free again
+  output << " " << heap.peek();
+  HeapItem top = heap.pop();
+  output << " " << top << heap.containsHandle(7) << " " << heap.get(12);
+  heap.push(HeapItem{1, 1000});  // a large id
+  output << " " << heap.peekHandle() << " " << heap.toString();
+
+  //! expect ----------------------------------
+  string expect =
+      "12 3 100 10 IndexedHeap: an item with this id is already in the heap; "
+      "IndexedHeap: itemId must be >= 0; 7:10 20 7:5 7:50 12:30 1000 "
+      "[1000:1,12:30,3:20]";
+
+  //! remove data -----------------------------
+  heap.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,50 @@
+#include <forward_list>
+#include <list>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Heap::heap07() {
+  string name = "heap07";
+  //! data ------------------------------------
+  // pushAll from forward iterators (a forward_list, a list): a small batch
+  // is pushed item by item, a large one rebuilds the heap bottom-up
+  forward_list<int> small = {8, 3, 9};
+  list<int> large;
+  for (int key = 0; key < 50; key++) large.push_back((key * 37) % 50);
+  Heap<int> heap;
+  DaryHeap<int, 4> dary;
+  for (int key = 100; key < 110; key++) {
+    heap.push(key);
+    dary.push(key);
+  }
+
+  stringstream output;
+  heap.pushAll(small.begin(), small.end());  // 3 < 10: reheapUp
+  dary.pushAll(small.begin(), small.end());
+  output << heap.size() << " " << heap.peek() << " " << dary.size() << " "
+         << dary.peek();
+  heap.pushAll(large.begin(), large.end());  // 50 >= 13: bottom-up
+  dary.pushAll(large.begin(), large.end());
+  output << " " << heap.size() << " " << dary.size();
+
+  int last = -1, unordered = 0;
+  while (!heap.empty()) {
+    int key = heap.pop();
+    if (key < last || key != dary.pop()) unordered++;
+    last = key;
+  }
+  output << " " << unordered << " " << dary.empty();
+  try {
+    dary.pop();
+  } catch (underflow_error &e) {
+    output << " " << e.what();
+  }
+
+  //! expect ----------------------------------
+  string expect = "13 3 13 3 63 63 0 1 Calling to pop with the empty heap.";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,52 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Heap::heap08() {
+  string name = "heap08";
+  //! data ------------------------------------
+  // PairingHeap: decreaseKey of the root (no cut) and below it (a first
+  // child, a later sibling: cut and linked to the root), erase of the root,
+  // of an inner node (its children go back into the heap) and of a leaf;
+  // the wrong direction throws invalid_argument
+  typedef PairingHeap<int>::Node Node;
+  PairingHeap<int> heap;
+  vector<Node *> handles;
+  for (int key = 10; key <= 80; key += 10) handles.push_back(heap.insert(key));
+  heap.pop();  // 10: the pairing builds a deeper tree for the cuts below
+  handles[0] = 0;
+
+  stringstream output;
+  heap.decreaseKey(handles[1], 15);  // the root
+  output << heap.peek();
+  heap.decreaseKey(handles[7], 5);  // below the root
+  output << " " << heap.peek() << " " << heap.get(handles[1]);
+  heap.decreaseKey(handles[4], 1);  // another one
+  heap.decreaseKey(handles[5], 45);
+  output << " " << heap.peek() << " " << heap.size();
+  try {
+    heap.decreaseKey(handles[5], 46);
+  } catch (invalid_argument &e) {
+    output << " " << e.what();
+  }
+  heap.decreaseKey(handles[5], 45);  // equal: accepted
+
+  output << "; " << heap.erase(handles[3]) << " " << heap.erase(handles[4]);
+  output << " " << heap.erase(handles[6]) << " " << heap.size() << " "
+         << heap.peek();
+  output << " ";
+  while (!heap.empty()) output << heap.pop() << ",";
+  try {
+    heap.pop();
+  } catch (underflow_error &e) {
+    output << " " << e.what();
+  }
+
+  //! expect ----------------------------------
+  string expect =
+      "15 5 15 1 7 decreaseKey: the new item is after the current one; 40 1 "
+      "70 4 5 5,15,30,45, Calling to pop with the empty heap.";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,84 @@
+#include <map>
+#include <random>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Heap::heap09() {
+  string name = "heap09";
+  //! data ------------------------------------
+  // PairingHeap against a model: random inserts, decreaseKeys (cuts at any
+  // depth), erases and pops; the keys are unique (a serial in the low 16
+  // bits) so that a pop tells which handle left. Then meld: the handles of
+  // the melded heap stay valid in this one, the other one is empty
+  typedef PairingHeap<int>::Node Node;
+  const int low = 1 << 16;
+  mt19937 gen(25);
+  PairingHeap<int> heap;
+  map<int, Node *> model;  // key => handle
+  vector<Node *> live;
+  int wrong = 0;
+  for (int step = 0; step < 20000; step++) {
+    int op = gen() % 6;  // the heap grows: 3 inserts for 2 removes
+    if (op <= 2 || live.empty()) {
+      int key = (int)(gen() % 10000) * low + step;
+      Node *handle = heap.insert(key);
+      model[key] = handle;
+      live.push_back(handle);
+    } else if (op == 3) {
+      Node *handle = live[gen() % live.size()];
+      int key = heap.get(handle);
+      int smaller = key - (int)(gen() % 100) * low;
+      heap.decreaseKey(handle, smaller);
+      model.erase(key);
+      model[smaller] = handle;
+    } else {
+      Node *handle = op == 4 ? live[gen() % live.size()] : model.begin()->second;
+      int key = heap.get(handle);
+      if ((op == 4 ? heap.erase(handle) : heap.pop()) != key) wrong++;
+      model.erase(key);
+      for (int idx = 0; idx < (int)live.size(); idx++) {
+        if (live[idx] != handle) continue;
+        live[idx] = live.back();
+        live.pop_back();
+        break;
+      }
+    }
+    if ((int)model.size() != heap.size()) wrong++;
+    else if (!heap.empty() && model.begin()->first != heap.peek()) wrong++;
+  }
+  for (auto &entry : model)
+    if (heap.get(entry.second) != entry.first) wrong++;
+
+  stringstream output;
+  output << wrong;
+
+  PairingHeap<int> other;
+  Node *a = other.insert(-5);
+  Node *b = other.insert(50);
+  int size = heap.size();
+  heap.meld(other);
+  output << " " << (heap.size() == size + 2) << other.empty() << other.size();
+  output << " " << heap.peek() << " " << heap.get(b);
+  heap.decreaseKey(b, -10);  // a melded handle
+  output << " " << heap.pop() << " " << heap.erase(a);
+  other.insert(7);  // the emptied heap still works
+  output << " " << other.pop();
+  heap.meld(heap);  // itself: nothing
+  output << " " << (heap.size() == size);
+
+  int last = -2000000000, unordered = 0;
+  while (!heap.empty()) {
+    int key = heap.pop();
+    if (key < last) unordered++;
+    last = key;
+  }
+  output << " " << unordered;
+
+  //! expect ----------------------------------
+  string expect = "0 110 -5 50 -10 -5 7 1 0";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <random>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Heap::heap10() {
+  string name = "heap10";
+  //! data ------------------------------------
+  // RadixHeap: the pops refill bucket 0 from the higher buckets (keys far
+  // apart, equal keys, 64-bit keys); pushes between pops may not go below the
+  // last popped key (invalid_argument, nothing pushed), equal to it is fine
+  RadixHeap<uint64_t> heap;
+  uint64_t keys[] = {1000, 3, 3, 1ULL << 40, 7, 1ULL << 63, 64, 65, 0};
+  for (uint64_t key : keys) heap.push(key);
+
+  stringstream output;
+  for (int idx = 0; idx < 5; idx++) output << heap.pop() << ",";
+  output << " " << heap.lastKey() << " " << heap.size();
+  try {
+    heap.push(63);
+  } catch (invalid_argument &e) {
+    output << " " << e.what();
+  }
+  output << " " << heap.size();
+  heap.push(64);  // == last
+  heap.push(66);
+  output << " " << heap.peek() << " ";
+  while (!heap.empty()) output << heap.pop() << ",";
+  try {
+    heap.pop();
+  } catch (underflow_error &e) {
+    output << " " << e.what();
+  }
+  heap.clear();  // last goes back to 0
+  heap.push(0);
+  output << " " << heap.pop();
+
+  // a monotone random workload against sorting, with float keys
+  mt19937 gen(10);
+  RadixHeap<float, FloatRadixKey<float> > floats;
+  vector<float> pushed, popped;
+  float lastPopped = 0;
+  for (int step = 0; step < 20000; step++) {
+    if (gen() % 3 != 0 || floats.empty()) {
+      float key = lastPopped + (float)(gen() % 1000) / 8;
+      floats.push(key);
+      pushed.push_back(key);
+    } else {
+      lastPopped = floats.pop();
+      popped.push_back(lastPopped);
+    }
+  }
+  while (!floats.empty()) popped.push_back(floats.pop());
+  sort(pushed.begin(), pushed.end());
+  output << " " << (popped == pushed);
+
+  //! expect ----------------------------------
+  string expect =
+      "0,3,3,7,64, 64 4 RadixHeap: the key is below the last popped key 4 64 "
+      "64,65,66,1000,1099511627776,9223372036854775808, Calling to pop with "
+      "the empty heap. 0 1";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
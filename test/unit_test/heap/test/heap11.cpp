@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_Heap::heap11() {
+  string name = "heap11";
+  //! data ------------------------------------
+  // TopK: offer/threshold/sorted/merge, k <= 0 and k > n; topK over 4
+  // threads against a full sort, with many ties, for both orders
+  stringstream output;
+  TopK<int> best(3);
+  int items[] = {5, 1, 9, 5, 7, 9, 2};
+  for (int item : items) output << best.offer(item);
+  output << " " << best.threshold() << " " << best.size() << best.full();
+  vector<int> sorted = best.sorted();
+  output << " " << sorted[0] << sorted[1] << sorted[2] << " "
+         << best.offer(7) << best.offer(8) << " " << best.threshold();
+
+  TopK<int> other(3);
+  other.offer(10);
+  other.offer(6);
+  best.merge(other);  // other is not changed
+  sorted = best.sorted();
+  output << " " << sorted[0] << "," << sorted[1] << "," << sorted[2] << " "
+         << other.size();
+
+  TopK<int> none(0), negative(-2), large(10);
+  output << " " << none.offer(1) << negative.offer(1) << none.size()
+         << negative.size();
+  for (int item : items) large.offer(item);
+  sorted = large.sorted();
+  output << " " << sorted.size() << large.full() << " ";
+  for (int item : sorted) output << item;
+  large.clear();
+  try {
+    large.threshold();
+  } catch (underflow_error &e) {
+    output << " thrown";
+  }
+
+  mt19937 gen(24);
+  vector<int> data(100000);
+  for (int &item : data) item = gen() % 1000;  // ~100 copies of each value
+  vector<int> descending = data;
+  sort(descending.begin(), descending.end(), greater<int>());
+  int mismatches = 0;
+  for (int k : {0, 1, 100, 5000, 100000, 200000}) {
+    vector<int> top = topK(data.begin(), data.end(), k, 4);
+    vector<int> expected(descending.begin(),
+                         descending.begin() + min((size_t)k, data.size()));
+    if (top != expected) mismatches++;
+    vector<int> bottom = topK(data.begin(), data.end(), k, 4, greater<int>());
+    vector<int> expectedBottom(descending.rbegin(),
+                               descending.rbegin() + min((size_t)k, data.size()));
+    if (bottom != expectedBottom) mismatches++;
+  }
+  vector<int> empty;
+  output << "; " << mismatches << " "
+         << topK(empty.begin(), empty.end(), 5, 4).size() << " "
+         << topK(data.begin(), data.end(), -1, 4).size() << " "
+         << topK(data.begin(), data.begin() + 3, 5).size();
+
+  //! expect ----------------------------------
+  string expect = "1111110 7 31 997 01 8 10,9,9 2 0000 70 9975521 thrown; 0 0 0 3";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
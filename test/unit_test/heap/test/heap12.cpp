@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+
+#include "../unit_test.hpp"
+
+int heap12MaxComparator(int &lhs, int &rhs) {
+  return lhs > rhs ? -1 : (lhs < rhs ? +1 : 0);
+}
+
+/*
+ * heap12Random: random pushes, interior removes and replaceTops against a
+ *  sorted model (first: the item that must be on top); return the mismatches
+ */
+template <class H, class Before>
+int heap12Random(H &heap, Before before, int seed) {
+  mt19937 gen(seed);
+  vector<int> model;
+  int wrong = 0;
+  for (int step = 0; step < 6000; step++) {
+    int op = gen() % 6;
+    if (op <= 2 || model.empty()) {
+      int item = gen() % 500;
+      heap.push(item);
+      model.push_back(item);
+    } else if (op == 3) {
+      int item = model[gen() % model.size()];  // anywhere in the heap
+      heap.remove(item);
+      model.erase(find(model.begin(), model.end(), item));
+    } else if (op == 4) {
+      int item = gen() % 500;
+      int top = *min_element(model.begin(), model.end(), before);
+      if (heap.replaceTop(item) != top) wrong++;
+      model.erase(find(model.begin(), model.end(), top));
+      model.push_back(item);
+    } else {
+      int top = *min_element(model.begin(), model.end(), before);
+      if (heap.pop() != top) wrong++;
+      model.erase(find(model.begin(), model.end(), top));
+    }
+    if (heap.size() != (int)model.size()) wrong++;
+  }
+  H copy(heap);  // the copy drains, the heap keeps its items
+  sort(model.begin(), model.end(), before);
+  for (int item : model)
+    if (copy.pop() != item) wrong++;
+  if (!copy.empty() || heap.size() != (int)model.size()) wrong++;
+  copy = heap;  // assigned: the same items again
+  copy.push(-1);
+  heap.clear();
+  if (copy.size() != (int)model.size() + 1) wrong++;
+  return wrong;
+}
+
+bool UNIT_TEST_Heap::heap12() {
+  string name = "heap12";
+  //! data ------------------------------------
+  // DaryHeap at arity 2, 4 and 8, min-heaps and HeapComparator max-heaps:
+  // random pushes, interior removes, replaceTop and pop against a model,
+  // copy and assignment; then a remove whose last item must go up
+  typedef HeapComparator<int, &heap12MaxComparator> MaxFirst;
+  DaryHeap<int, 2> min2;
+  DaryHeap<int, 4> min4;
+  DaryHeap<int, 8> min8;
+  DaryHeap<int, 2, MaxFirst> max2;
+  DaryHeap<int, 4, MaxFirst> max4;
+  DaryHeap<int, 8, MaxFirst> max8;
+  less<int> ascending;
+  greater<int> descending;
+
+  stringstream output;
+  output << heap12Random(min2, ascending, 2) << heap12Random(min4, ascending, 4)
+         << heap12Random(min8, ascending, 8) << heap12Random(max2, descending, 2)
+         << heap12Random(max4, descending, 4)
+         << heap12Random(max8, descending, 8);
+
+  // level order: the arrays are the heaps; removing 11 puts 4 under 10
+  int up[] = {1, 10, 2, 11, 12, 3, 4};
+  DaryHeap<int, 2> binary;
+  for (int item : up) binary.push(item);
+  binary.remove(11);
+  output << " " << binary.toString();
+  // arity 4: 51..54 under 50, 11 (the last) under 10; removing 52 puts 11
+  // under 50: it goes up one level
+  int wide[] = {1, 50, 10, 70, 80, 51, 52, 53, 54, 11};
+  DaryHeap<int, 4> four;
+  for (int item : wide) four.push(item);
+  four.remove(52);
+  output << " " << four.toString() << " " << four.replaceTop(100) << " "
+         << four.toString();
+
+  //! expect ----------------------------------
+  string expect =
+      "000000 [1,4,2,10,12,3] [1,11,10,70,80,51,50,53,54] 1 "
+      "[10,11,100,70,80,51,50,53,54]";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,127 @@
+#ifndef UNIT_TEST_Heap_HPP
+#define UNIT_TEST_Heap_HPP
+
+#include "heap/DaryHeap.h"
+#include "heap/Heap.h"
+#include "heap/IndexedHeap.h"
+#include "heap/PairingHeap.h"
+#include "heap/RadixHeap.h"
+#include "heap/TopK.h"
+#include "library.hpp"
+
+/*
+ * HeapItem: items with a key and an id; == compares the ids (as in Dijkstra,
+ *  one item per vertex), < and > the keys
+ */
+struct HeapItem {
+  int key;
+  int id;
+  bool operator==(const HeapItem &rhs) const { return id == rhs.id; }
+  bool operator<(const HeapItem &rhs) const { return key < rhs.key; }
+  bool operator>(const HeapItem &rhs) const { return key > rhs.key; }
+};
+inline ostream &operator<<(ostream &os, const HeapItem &item) {
+  return os << item.id << ":" << item.key;
+}
+inline int heapItemId(HeapItem &item) { return item.id; }
+
+class UNIT_TEST_Heap {
+ public:
+  UNIT_TEST_Heap() {
+    // TODO unit test new
+    registerTest("heap01", &UNIT_TEST_Heap::heap01);
+    registerTest("heap02", &UNIT_TEST_Heap::heap02);
+    registerTest("heap03", &UNIT_TEST_Heap::heap03);
+    registerTest("heap04", &UNIT_TEST_Heap::heap04);
+    registerTest("heap05", &UNIT_TEST_Heap::heap05);
+    registerTest("heap06", &UNIT_TEST_Heap::heap06);
+    registerTest("heap07", &UNIT_TEST_Heap::heap07);
+    registerTest("heap08", &UNIT_TEST_Heap::heap08);
+    registerTest("heap09", &UNIT_TEST_Heap::heap09);
+    registerTest("heap10", &UNIT_TEST_Heap::heap10);
+    registerTest("heap11", &UNIT_TEST_Heap::heap11);
+    registerTest("heap12", &UNIT_TEST_Heap::heap12);
+  }
+
+ private:
+  // TODO unit test new
+  bool heap01();
+  bool heap02();
+  bool heap03();
+  bool heap04();
+  bool heap05();
+  bool heap06();
+  bool heap07();
+  bool heap08();
+  bool heap09();
+  bool heap10();
+  bool heap11();
+  bool heap12();
+
+ public:
+  static map<string, bool (UNIT_TEST_Heap::*)()> TESTS;
+  // ANSI escape codes for colors
+  const string green = "\033[32m";
+  const string red = "\033[31m";
+  const string cyan = "\033[36m";
+  const string reset = "\033[0m";  // To reset to default color
+
+  // print result test case
+  bool printResult(string output, string expect, string name) {
+    if (expect == output) {
+      cout << green << "test " + name + " --------------- PASS" << reset
+           << "\n";
+      return true;
+    } else {
+      cout << red << "test " + name + " --------------- FAIL" << reset << "\n";
+      cout << "\texpect : " << expect << endl;
+      cout << "\toutput : " << output << endl;
+      return false;
+    }
+  }
+  // run 1 test case
+  void runTest(const std::string &name) {
+    auto it = TESTS.find(name);
+    if (it != TESTS.end()) {
+      (this->*(it->second))();
+    } else {
+      throw std::runtime_error("Test with name '" + name + "' does not exist.");
+    }
+  }
+  // run all test case
+  void runAllTests() {
+    vector<string> fails;
+    for (const auto &test : TESTS) {
+      if (!(this->*(test.second))()) {
+        fails.push_back(test.first);
+      }
+    }
+
+    cout << cyan << "\nResult -------------------------" << reset << endl;
+    // Print the results
+    if (fails.empty()) {
+      cout << green << "All tests passed!" << reset << endl;
+    } else {
+      int totalTests = TESTS.size();
+      int failedTests = fails.size();
+      int passedTests = totalTests - failedTests;
+      double passRate =
+          (totalTests > 0)
+              ? (static_cast<double>(passedTests) / totalTests) * 100.0
+              : 0.0;
+      cout << red << "Some tests failed:";
+      for (const auto &fail : fails) {
+        cout << "  " << fail;
+      }
+      cout << cyan << "\nPass rate: " << passRate << "%" << reset << endl;
+    }
+  }
+  static void registerTest(string name, bool (UNIT_TEST_Heap::*function)()) {
+    if (TESTS.find(name) != TESTS.end()) {
+      throw std::runtime_error("Test with name '" + name + "' already exists.");
+    }
+    TESTS[name] = function;
+  }
+};
+
+#endif  // UNIT_TEST_Heap_HPP
\ No newline at end of file
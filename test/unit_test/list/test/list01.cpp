@@ -0,0 +1,29 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list01() {
+  string name = "list01";
+  //! data ------------------------------------
+  DLinkedList<int> list;
+  for (int idx = 0; idx < 10; idx++) list.add(idx);
+
+  // erase every even item while traversing
+  for (auto it = list.begin(); it != list.end();) {
+    if (*it % 2 == 0)
+      it = list.erase(it);
+    else
+      it++;
+  }
+
+  //! expect ----------------------------------
+  string expect = "[1, 3, 5, 7, 9]; size=5";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << list.toString() << "; size=" << list.size();
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,29 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list02() {
+  string name = "list02";
+  //! data ------------------------------------
+  DLinkedList<int> list;
+  for (int idx = 1; idx <= 6; idx++) list.add(idx * 10);
+
+  // Iterator::remove steps back, so ++ reaches the item after the removed one
+  stringstream visited;
+  for (auto it = list.begin(); it != list.end(); it++) {
+    visited << *it << " ";
+    if (*it == 10 || *it == 30 || *it == 60) it.remove();
+  }
+
+  //! expect ----------------------------------
+  string expect = "10 20 30 40 50 60 | [20, 40, 50] | 20 50";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << visited.str() << "| " << list.toString() << " | " << list.get(0)
+         << " " << list.get(list.size() - 1);
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,26 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list03() {
+  string name = "list03";
+  //! data ------------------------------------
+  DLinkedList<int> list;
+  int data[] = {4, -1, 7, -3, -8, 2, -5};
+  for (int idx = 0; idx < 7; idx++) list.add(data[idx]);
+
+  int nremoved = list.remove_if([](int &item) { return item < 0; });
+  int nnone = list.remove_if([](int &item) { return item > 100; });
+
+  //! expect ----------------------------------
+  string expect = "removed=4; none=0; [4, 7, 2]; size=3";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << "removed=" << nremoved << "; none=" << nnone << "; "
+         << list.toString() << "; size=" << list.size();
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
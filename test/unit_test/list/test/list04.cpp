@@ -0,0 +1,28 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list04() {
+  string name = "list04";
+  //! data ------------------------------------
+  DLinkedList<int> list;
+  for (int idx = 1; idx <= 5; idx++) list.add(idx);
+
+  // insert a negated copy in front of every odd item, then one more at the end
+  for (auto it = list.begin(); it != list.end(); it++) {
+    if (*it % 2 == 1) list.insert_before(it, -*it);
+  }
+  auto last = list.insert_before(list.end(), 99);
+
+  //! expect ----------------------------------
+  string expect = "[-1, 1, 2, -3, 3, 4, -5, 5, 99]; size=9; last=99; get(3)=-3";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << list.toString() << "; size=" << list.size() << "; last=" << *last
+         << "; get(3)=" << list.get(3);
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
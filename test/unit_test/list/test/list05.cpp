@@ -0,0 +1,26 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list05() {
+  string name = "list05";
+  //! data ------------------------------------
+  DLinkedList<int> list;
+  for (int idx = 0; idx < 8; idx++) list.add(idx);
+
+  // remove items while traversing backward
+  for (auto it = list.bbegin(); it != list.bend(); it--) {
+    if (*it % 3 == 0) it.remove();
+  }
+
+  //! expect ----------------------------------
+  string expect = "[1, 2, 4, 5, 7]; size=5";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << list.toString() << "; size=" << list.size();
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
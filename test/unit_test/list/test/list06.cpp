@@ -0,0 +1,29 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list06() {
+  string name = "list06";
+  //! data ------------------------------------
+  DLinkedList<int> list;
+  for (int idx = 0; idx < 10; idx++) list.add(idx);
+
+  // indexed access before and after mutations through iterators
+  stringstream output;
+  output << list.get(5) << " " << list.get(6) << " ";
+  auto it = list.begin();
+  for (int idx = 0; idx < 3; idx++) it++;
+  it = list.erase(it);          // removes 3
+  list.insert_before(it, 33);   // in front of 4
+  output << list.get(5) << " " << list.get(6) << " " << list.get(3) << " ";
+  list.remove_if([](int &item) { return item < 3; });
+  output << list.get(0) << " " << list.get(list.size() - 1) << " "
+         << list.indexOf(33);
+
+  //! expect ----------------------------------
+  string expect = "5 6 5 6 33 33 9 0";
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,34 @@
+#include "../unit_test.hpp"
+
+int list07_deleted = 0;
+void list07_deleteItem(int *item) {
+  list07_deleted++;
+  delete item;
+}
+
+bool UNIT_TEST_List::list07() {
+  string name = "list07";
+  //! data ------------------------------------
+  DLinkedList<int *> list(&DLinkedList<int *>::free);
+  for (int idx = 0; idx < 6; idx++) list.add(new int(idx));
+
+  list07_deleted = 0;
+  auto it = list.begin();
+  it = list.erase(it, &list07_deleteItem);
+  int nremoved = list.remove_if([](int *&item) { return *item >= 4; },
+                                &list07_deleteItem);
+
+  //! expect ----------------------------------
+  string expect = "removed=2; deleted=3; front=1; size=3";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << "removed=" << nremoved << "; deleted=" << list07_deleted
+         << "; front=" << **it << "; size=" << list.size();
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
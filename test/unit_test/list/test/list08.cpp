@@ -0,0 +1,32 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list08() {
+  string name = "list08";
+  //! data ------------------------------------
+  DLinkedList<int> list;
+
+  //! output ----------------------------------
+  stringstream output;
+  try {
+    list.erase(list.end());
+    output << "no exception; ";
+  } catch (const std::out_of_range &e) {
+    output << "out_of_range; ";
+  }
+  list.insert_before(list.begin(), 2);
+  list.insert_before(list.begin(), 1);
+  list.erase(list.begin());
+  list.erase(list.begin());
+  output << list.toString() << "; empty=" << list.empty();
+  list.add(7);
+  output << "; " << list.toString();
+
+  //! expect ----------------------------------
+  string expect = "out_of_range; []; empty=1; [7]";
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,42 @@
+#include "../unit_test.hpp"
+
+class List09Item : public IntrusiveListHook<> {
+ public:
+  int value;
+  List09Item(int value = 0) : value(value) {}
+};
+string list09_item2str(List09Item *item) { return to_string(item->value); }
+
+bool UNIT_TEST_List::list09() {
+  string name = "list09";
+  //! data ------------------------------------
+  List09Item items[6];
+  IntrusiveList<List09Item> list;
+  for (int idx = 0; idx < 6; idx++) {
+    items[idx].value = idx;
+    list.add(&items[idx]);
+  }
+
+  // O(1) removal through the item itself, then re-insertion at an index
+  list.removeItem(&items[2]);
+  list.removeItem(&items[5]);
+  bool again = list.removeItem(&items[2]);
+  list.add(0, &items[5]);
+
+  //! expect ----------------------------------
+  string expect =
+      "[5, 0, 1, 3, 4]; size=5; again=0; linked=1; indexOf=3; get(4)=4";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << list.toString(&list09_item2str) << "; size=" << list.size()
+         << "; again=" << again << "; linked=" << items[5].linked()
+         << "; indexOf=" << list.indexOf(&items[3])
+         << "; get(4)=" << list.get(4)->value;
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,42 @@
+#include "../unit_test.hpp"
+
+class List10Item : public IntrusiveListHook<> {
+ public:
+  int value;
+  List10Item(int value = 0) : value(value) {}
+};
+string list10_item2str(List10Item *item) { return to_string(item->value); }
+
+bool UNIT_TEST_List::list10() {
+  string name = "list10";
+  //! data ------------------------------------
+  IntrusiveList<List10Item> list(&IntrusiveList<List10Item>::free);
+  for (int idx = 0; idx < 8; idx++) list.add(new List10Item(idx));
+
+  // remove while traversing forward and backward
+  for (auto it = list.begin(); it != list.end(); it++) {
+    if ((*it)->value % 3 == 0) it.remove([](List10Item *item) { delete item; });
+  }
+  stringstream backward;
+  for (auto it = list.bbegin(); it != list.bend(); it--) {
+    backward << (*it)->value << " ";
+    if ((*it)->value == 7) it.remove([](List10Item *item) { delete item; });
+  }
+
+  // moving the list relinks the items, nothing is copied
+  IntrusiveList<List10Item> other(std::move(list));
+
+  //! expect ----------------------------------
+  string expect = "7 5 4 2 1 | [1, 2, 4, 5]; moved=0; size=4";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << backward.str() << "| " << other.toString(&list10_item2str)
+         << "; moved=" << list.size() << "; size=" << other.size();
+
+  //! remove data -----------------------------
+  other.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,34 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list11() {
+  string name = "list11";
+  //! data ------------------------------------
+  DLinkedList<int> list;
+  for (int idx = 0; idx < 10; idx++) list.add(idx);
+
+  // each mutation must shift or drop the cursor left by the previous get()
+  stringstream output;
+  output << list.get(5);  // cursor at 5
+  list.add(2, 100);       // insert before the cursor
+  output << " " << list.get(6);
+  output << " " << list.removeAt(6);  // remove the cursor node
+  output << " " << list.get(6);
+  list.removeAt(0);  // remove before the cursor
+  output << " " << list.get(5);
+  list.add(8, 200);  // insert after the cursor
+  output << " " << list.get(5) << " " << list.get(8);
+  list.removeItem(6);  // removal by value
+  output << " " << list.get(4) << " " << list.get(5);
+
+  //! expect ----------------------------------
+  string expect = "5 5 5 6 6 6 200 4 7; [1, 100, 2, 3, 4, 7, 8, 200, 9]";
+
+  //! output ----------------------------------
+  output << "; " << list.toString();
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
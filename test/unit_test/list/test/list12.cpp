@@ -0,0 +1,44 @@
+#include <random>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list12() {
+  string name = "list12";
+  //! data ------------------------------------
+  DLinkedList<int> list;
+  vector<int> model;
+  mt19937 gen(12);
+
+  // random add/removeAt/get near the last index, checked against a vector
+  int index = 0, mismatches = 0;
+  for (int step = 0; step < 5000; step++) {
+    int op = gen() % 4;
+    int size = (int)model.size();
+    index = max(0, min(size, index + (int)(gen() % 7) - 3));
+    if (op == 0 || size == 0) {
+      list.add(index, step);
+      model.insert(model.begin() + index, step);
+    } else if (op == 1 && index < size) {
+      if (list.removeAt(index) != model[index]) mismatches++;
+      model.erase(model.begin() + index);
+    } else if (index < size) {
+      if (list.get(index) != model[index]) mismatches++;
+    }
+  }
+  for (int idx = (int)model.size() - 1; idx >= 0; idx--)
+    if (list.get(idx) != model[idx]) mismatches++;
+
+  //! expect ----------------------------------
+  string expect = "mismatches=0; same size=1";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << "mismatches=" << mismatches
+         << "; same size=" << (list.size() == (int)model.size());
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,51 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list13() {
+  string name = "list13";
+  //! data ------------------------------------
+  XArrayList<int> list(0, 0, 2);  // small capacity: the adds below must grow it
+  for (int idx = 0; idx < 5; idx++) list.add(idx);
+  list.add(0, 10);
+  list.add(3, 11);
+  list.add(list.size(), 12);
+
+  stringstream output;
+  output << list.toString();
+  output << "; removeAt(1)=" << list.removeAt(1);
+  output << "; removeItem(11)=" << list.removeItem(11);
+  output << "; removeItem(99)=" << list.removeItem(99);
+  output << "; indexOf(3)=" << list.indexOf(3) << "; indexOf(99)=" << list.indexOf(99);
+  output << "; contains(12)=" << list.contains(12) << "; get(2)=" << list.get(2);
+
+  int thrown = 0;
+  try { list.get(list.size()); } catch (std::out_of_range &e) { thrown++; }
+  try { list.add(list.size() + 1, 0); } catch (std::out_of_range &e) { thrown++; }
+  try { list.removeAt(-1); } catch (std::out_of_range &e) { thrown++; }
+  output << "; thrown=" << thrown;
+
+  // a copy is independent of the original
+  XArrayList<int> copy(list);
+  copy.add(7);
+  copy.removeAt(0);
+  output << "; " << list.toString() << " " << copy.toString();
+
+  // an owning list deletes its pointers (checked by the sanitizer)
+  XArrayList<int *> owned(&XArrayList<int *>::free);
+  for (int idx = 0; idx < 20; idx++) owned.add(new int(idx));
+  output << "; owned=" << *owned.get(19);
+
+  //! expect ----------------------------------
+  string expect =
+      "[10, 0, 1, 11, 2, 3, 4, 12]; removeAt(1)=0; removeItem(11)=1; "
+      "removeItem(99)=0; indexOf(3)=3; indexOf(99)=-1; contains(12)=1; "
+      "get(2)=2; thrown=3; [10, 1, 2, 3, 4, 12] [1, 2, 3, 4, 12, 7]; "
+      "owned=19; empty=1";
+
+  //! remove data -----------------------------
+  list.clear();
+  output << "; empty=" << list.empty();
+  owned.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
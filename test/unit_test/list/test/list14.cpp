@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <random>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list14() {
+  string name = "list14";
+  //! data ------------------------------------
+  XArrayList<int> list;
+  vector<int> model;
+  mt19937 gen(14);
+
+  // random add/removeAt/removeItem/get, checked against a vector
+  int mismatches = 0;
+  for (int step = 0; step < 5000; step++) {
+    int op = gen() % 5;
+    int size = (int)model.size();
+    int index = size > 0 ? gen() % (size + 1) : 0;
+    if (op <= 1 || size == 0) {
+      list.add(index, step);
+      model.insert(model.begin() + index, step);
+    } else if (op == 2 && index < size) {
+      if (list.removeAt(index) != model[index]) mismatches++;
+      model.erase(model.begin() + index);
+    } else if (op == 3 && index < size) {
+      int item = model[index];
+      list.removeItem(item);
+      model.erase(std::find(model.begin(), model.end(), item));
+    } else if (index < size) {
+      if (list.get(index) != model[index] || list.indexOf(model[index]) != index)
+        mismatches++;
+    }
+  }
+  int idx = 0;
+  for (int item : list)
+    if (item != model[idx++]) mismatches++;
+
+  //! expect ----------------------------------
+  string expect = "mismatches=0; same size=1";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << "mismatches=" << mismatches
+         << "; same size=" << (list.size() == (int)model.size());
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <random>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list16() {
+  string name = "list16";
+  //! data ------------------------------------
+  UnrolledLinkedList<int, 4> list;
+  vector<int> model;
+  mt19937 gen(16);
+
+  // random add/removeAt/removeItem/get, checked against a vector; the list
+  // grows, then shrinks to empty, so chunks are split, merged and freed
+  int mismatches = 0;
+  for (int step = 0; step < 6000; step++) {
+    int op = gen() % 5;
+    if (step >= 4000) op = 2 + op % 2;  // removals only
+    int size = (int)model.size();
+    int index = size > 0 ? gen() % (size + 1) : 0;
+    if (op <= 1) {
+      list.add(index, step);
+      model.insert(model.begin() + index, step);
+    } else if (op == 2 && index < size) {
+      if (list.removeAt(index) != model[index]) mismatches++;
+      model.erase(model.begin() + index);
+    } else if (op == 3 && index < size) {
+      int item = model[index];
+      list.removeItem(item);
+      model.erase(std::find(model.begin(), model.end(), item));
+    } else if (index < size) {
+      if (list.get(index) != model[index] || list.indexOf(model[index]) != index)
+        mismatches++;
+    }
+    if (step == 3999) {
+      int idx = 0;
+      for (int item : list)
+        if (item != model[idx++]) mismatches++;
+    }
+  }
+  while (!model.empty()) {
+    if (list.removeAt(0) != model[0]) mismatches++;
+    model.erase(model.begin());
+  }
+
+  //! expect ----------------------------------
+  string expect = "mismatches=0; size=0; chunks=0";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << "mismatches=" << mismatches << "; size=" << list.size()
+         << "; chunks=" << list.chunkCount();
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,43 @@
+#include "../unit_test.hpp"
+
+string list17_ptr2str(int *&item) { return to_string(*item); }
+
+bool UNIT_TEST_List::list17() {
+  string name = "list17";
+  //! data ------------------------------------
+  // owning lists: the spliced pointers must be deleted once, by the receiver
+  DLinkedList<int *>::NodePool pool;
+  DLinkedList<int *> a(&DLinkedList<int *>::free, 0, &pool);
+  DLinkedList<int *> b(&DLinkedList<int *>::free, 0, &pool);
+  DLinkedList<int *> c(&DLinkedList<int *>::free);  // plain new/delete nodes
+  for (int idx = 0; idx < 3; idx++) a.add(new int(idx));
+  for (int idx = 10; idx < 13; idx++) b.add(new int(idx));
+  for (int idx = 20; idx < 23; idx++) c.add(new int(idx));
+
+  // same pool: the nodes are relinked; in front of the second item
+  auto pos = a.begin();
+  pos++;
+  a.splice(pos, b);
+  // different pools: the items are moved, c keeps none of them
+  a.splice(a.end(), c);
+  a.splice(a.begin(), a);  // splicing a list into itself does nothing
+
+  //! expect ----------------------------------
+  string expect =
+      "[0, 10, 11, 12, 1, 2, 20, 21, 22]; size=9; b=0; c=0; get(6)=20; "
+      "get(1)=10";
+
+  //! output ----------------------------------
+  stringstream output;
+  output << a.toString(&list17_ptr2str) << "; size=" << a.size()
+         << "; b=" << b.size() << "; c=" << c.size()
+         << "; get(6)=" << *a.get(6) << "; get(1)=" << *a.get(1);
+
+  //! remove data -----------------------------
+  a.clear();
+  b.clear();
+  c.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,36 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_List::list18() {
+  string name = "list18";
+  //! data ------------------------------------
+  int array[] = {1, 2, 3, 4, 5};
+  vector<int> items = {6, 7};
+  DLinkedList<int> list(array, array + 3);  // range constructor
+  DLinkedList<int> other(items.begin(), items.end());
+  DLinkedList<int> none(array, array);
+
+  list.append(array + 3, 2);
+  list.append(array, 0);  // nothing to append
+  list.takeAll(other);
+  none.takeAll(other);  // other is already empty
+
+  stringstream output;
+  output << list.toString() << "; size=" << list.size()
+         << "; other=" << other.toString() << "; none=" << none.size();
+
+  // the emptied list is still usable
+  other.add(8);
+  list.takeAll(other);
+  output << "; " << list.get(7) << " " << list.indexOf(5) << " "
+         << other.empty();
+
+  //! expect ----------------------------------
+  string expect =
+      "[1, 2, 3, 4, 5, 6, 7]; size=7; other=[]; none=0; 8 4 1";
+
+  //! remove data -----------------------------
+  list.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,106 @@
+#include "../unit_test.hpp"
+
+// counts its copies and moves; built from (value, tag) only by emplace
+struct list19Item {
+  static int copies, moves;
+  int value;
+  char tag;
+  list19Item() : value(0), tag('-') {}
+  list19Item(int value, char tag) : value(value), tag(tag) {}
+  list19Item(const list19Item &item) : value(item.value), tag(item.tag) {
+    copies++;
+  }
+  list19Item(list19Item &&item) : value(item.value), tag(item.tag) {
+    moves++;
+  }
+  list19Item &operator=(const list19Item &item) {
+    value = item.value;
+    tag = item.tag;
+    copies++;
+    return *this;
+  }
+  list19Item &operator=(list19Item &&item) {
+    value = item.value;
+    tag = item.tag;
+    moves++;
+    return *this;
+  }
+  bool operator==(const list19Item &item) const {
+    return value == item.value && tag == item.tag;
+  }
+};
+int list19Item::copies = 0;
+int list19Item::moves = 0;
+
+ostream &operator<<(ostream &os, const list19Item &item) {
+  return os << item.tag << item.value;
+}
+
+bool UNIT_TEST_List::list19() {
+  string name = "list19";
+  //! data ------------------------------------
+  // emplace builds in the node (no copy, no move without a pool); add(T&&)
+  // and removeAt move; a moved-from list is empty and reusable (its cursor
+  // too); a moved-into list takes the source's NodePool with the nodes
+  stringstream output;
+  DLinkedList<list19Item>::NodePool pool(4);
+  DLinkedList<list19Item> list;
+  list.emplace_back(1, 'a');
+  list.emplace_back(2, 'b');
+  list19Item &front = list.emplace(0, 0, 'z');
+  output << front.tag << list19Item::copies << list19Item::moves << " ";
+
+  list19Item item(3, 'c');
+  list.add(std::move(item));
+  list.add(1, list19Item(4, 'd'));
+  output << list19Item::copies << list19Item::moves << " ";
+  list19Item out = list.removeAt(0);
+  output << out << list19Item::copies << " "
+         << list.toString() << " ";
+
+  list.get(2);  // leaves the cursor in the source
+  DLinkedList<list19Item> moved(std::move(list));
+  output << list19Item::copies << moved.size() << list.size() << list.empty()
+         << " ";
+  list.emplace_back(9, 'x');
+  list.add(list19Item(8, 'y'));
+  output << list.get(0) << list.get(1)
+         << list.indexOf(list19Item(8, 'y')) << " ";
+
+  DLinkedList<list19Item> target;
+  target.emplace_back(7, 'w');
+  target = std::move(moved);
+  output << target.toString() << moved.size() << " ";
+  moved.emplace_back(6, 'v');
+  output << moved.toString() << list19Item::copies << "; ";
+
+  // with a pool the item is built then moved into a recycled node
+  list19Item::moves = 0;
+  DLinkedList<list19Item> pooled(0, 0, &pool);
+  for (int idx = 0; idx < 3; idx++) pooled.emplace_back(idx, 'p');
+  output << list19Item::copies << list19Item::moves << " "
+         << pool.available() << " ";
+  DLinkedList<list19Item> taken(std::move(pooled));
+  output << (taken.getNodePool() == &pool) << (pooled.getNodePool() == &pool)
+         << pooled.size() << " ";
+  pooled.emplace_back(5, 'q');  // from the same pool, which is now empty
+  output << pool.available() << pool.capacity() << " ";
+
+  DLinkedList<list19Item> plain;
+  plain = std::move(taken);
+  output << (plain.getNodePool() == &pool) << plain.toString()
+         << taken.size() << " ";
+  plain.clear();
+  output << pool.available() << list19Item::copies;
+
+  //! expect ----------------------------------
+  string expect =
+      "z00 02 z00 [d4, a1, b2, c3] 0401 x9y81 [d4, a1, b2, c3]0 [v6]0; 03 1 "
+      "110 04 1[p0, p1, p2]0 30";
+
+  //! remove data -----------------------------
+  pooled.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,7 @@
+#include "unit_test.hpp"
+map<string, bool (UNIT_TEST_List::*)()> UNIT_TEST_List::TESTS;
+string int2str(int &v) {
+  stringstream os;
+  os << v;
+  return os.str();
+}
\ No newline at end of file
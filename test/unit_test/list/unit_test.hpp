@@ -0,0 +1,125 @@
+#ifndef UNIT_TEST_List_HPP
+#define UNIT_TEST_List_HPP
+
+#include "list/DLinkedList.h"
+#include "list/IntrusiveList.h"
+#include "list/XArrayList.h"
+#include "list/UnrolledLinkedList.h"
+#include "library.hpp"
+
+string int2str(int &v);
+
+class UNIT_TEST_List {
+ public:
+  UNIT_TEST_List() {
+    // TODO unit test new
+    registerTest("list01", &UNIT_TEST_List::list01);
+    registerTest("list02", &UNIT_TEST_List::list02);
+    registerTest("list03", &UNIT_TEST_List::list03);
+    registerTest("list04", &UNIT_TEST_List::list04);
+    registerTest("list05", &UNIT_TEST_List::list05);
+    registerTest("list06", &UNIT_TEST_List::list06);
+    registerTest("list07", &UNIT_TEST_List::list07);
+    registerTest("list08", &UNIT_TEST_List::list08);
+    registerTest("list09", &UNIT_TEST_List::list09);
+    registerTest("list10", &UNIT_TEST_List::list10);
+    registerTest("list11", &UNIT_TEST_List::list11);
+    registerTest("list12", &UNIT_TEST_List::list12);
+    registerTest("list13", &UNIT_TEST_List::list13);
+    registerTest("list14", &UNIT_TEST_List::list14);
+    registerTest("list15", &UNIT_TEST_List::list15);
+    registerTest("list16", &UNIT_TEST_List::list16);
+    registerTest("list17", &UNIT_TEST_List::list17);
+    registerTest("list18", &UNIT_TEST_List::list18);
+    registerTest("list19", &UNIT_TEST_List::list19);
+  }
+
+ private:
+  // TODO unit test new
+  bool list01();
+  bool list02();
+  bool list03();
+  bool list04();
+  bool list05();
+  bool list06();
+  bool list07();
+  bool list08();
+  bool list09();
+  bool list10();
+  bool list11();
+  bool list12();
+  bool list13();
+  bool list14();
+  bool list15();
+  bool list16();
+  bool list17();
+  bool list18();
+  bool list19();
+
+ public:
+  static map<string, bool (UNIT_TEST_List::*)()> TESTS;
+  // ANSI escape codes for colors
+  const string green = "\033[32m";
+  const string red = "\033[31m";
+  const string cyan = "\033[36m";
+  const string reset = "\033[0m";  // To reset to default color
+
+  // print result test case
+  bool printResult(string output, string expect, string name) {
+    if (expect == output) {
+      cout << green << "test " + name + " --------------- PASS" << reset
+           << "\n";
+      return true;
+    } else {
+      cout << red << "test " + name + " --------------- FAIL" << reset << "\n";
+      cout << "\texpect : " << expect << endl;
+      cout << "\toutput : " << output << endl;
+      return false;
+    }
+  }
+  // run 1 test case
+  void runTest(const std::string &name) {
+    auto it = TESTS.find(name);
+    if (it != TESTS.end()) {
+      (this->*(it->second))();
+    } else {
+      throw std::runtime_error("Test with name '" + name + "' does not exist.");
+    }
+  }
+  // run all test case
+  void runAllTests() {
+    vector<string> fails;
+    for (const auto &test : TESTS) {
+      if (!(this->*(test.second))()) {
+        fails.push_back(test.first);
+      }
+    }
+
+    cout << cyan << "\nResult -------------------------" << reset << endl;
+    // Print the results
+    if (fails.empty()) {
+      cout << green << "All tests passed!" << reset << endl;
+    } else {
+      int totalTests = TESTS.size();
+      int failedTests = fails.size();
+      int passedTests = totalTests - failedTests;
+      double passRate =
+          (totalTests > 0)
+              ? (static_cast<double>(passedTests) / totalTests) * 100.0
+              : 0.0;
+      cout << red << "Some tests failed:";
+      for (const auto &fail : fails) {
+        cout << "  " << fail;
+      }
+      cout << cyan << "\nPass rate: " << passRate << "%" << reset << endl;
+    }
+  }
+  static void registerTest(string name, bool (UNIT_TEST_List::*function)()) {
+    if (TESTS.find(name) != TESTS.end()) {
+      throw std::runtime_error("Test with name '" + name + "' already exists.");
+    }
+    TESTS[name] = function;
+  }
+};
+
+#endif  // UNIT_TEST_List_HPP
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_StackNQueue::queue01() {
+  string name = "queue01";
+  //! data ------------------------------------
+  MPMCQueue<int> queue(5);  // rounded up to 8
+
+  stringstream output;
+  output << "capacity=" << queue.getCapacity();
+  int pushed = 0;
+  while (queue.try_push(pushed)) pushed++;
+  output << "; pushed=" << pushed << "; size=" << queue.size()
+         << "; peek=" << queue.peek();
+
+  // FIFO, and the ring wraps around after the first pops
+  int item, popped = 0;
+  for (int idx = 0; idx < 3; idx++) popped += queue.pop();
+  for (int idx = 0; idx < 3; idx++) queue.push(100 + idx);
+  output << "; popped=" << popped << "; " << queue.toString();
+  output << "; contains(101)=" << queue.contains(101)
+         << "; remove(4)=" << queue.remove(4) << "; " << queue.toString();
+
+  while (queue.try_pop(item)) output << " " << item;
+  bool thrown = false;
+  try {
+    queue.pop();
+  } catch (Underflow &e) {
+    thrown = true;
+  }
+  output << "; empty=" << queue.empty() << "; thrown=" << thrown;
+
+  //! expect ----------------------------------
+  string expect =
+      "capacity=8; pushed=8; size=8; peek=0; popped=3; FRONT-TO-REAR: [3, 4, "
+      "5, 6, 7, 100, 101, 102]; contains(101)=1; remove(4)=1; FRONT-TO-REAR: "
+      "[3, 5, 6, 7, 100, 101, 102] 3 5 6 7 100 101 102; empty=1; thrown=1";
+
+  //! remove data -----------------------------
+  queue.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
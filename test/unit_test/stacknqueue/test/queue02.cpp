@@ -0,0 +1,20 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_StackNQueue::queue02() {
+  string name = "queue02";
+  //! data ------------------------------------
+  // a small ring: producers often find it full and consumers empty
+  MPMCQueue<int> queue(16);
+
+  //! expect ----------------------------------
+  string expect = "lost=0 duplicated=0 reordered=0 empty=1";
+
+  //! output ----------------------------------
+  string output = mpmcExchange(queue, 4, 4, 20000);
+
+  //! remove data -----------------------------
+  queue.clear();
+
+  //! result ----------------------------------
+  return printResult(output, expect, name);
+}
@@ -0,0 +1,39 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_StackNQueue::queue03() {
+  string name = "queue03";
+  //! data ------------------------------------
+  // 8 items per segment: 50 items link 7 segments, popping retires them
+  SegmentedMPMCQueue<int, 8> queue;
+  for (int idx = 0; idx < 50; idx++) queue.push(idx);
+
+  stringstream output;
+  output << "size=" << queue.size() << "; peek=" << queue.peek();
+  long long sum = 0;
+  for (int idx = 0; idx < 20; idx++) sum += queue.pop();
+  for (int idx = 50; idx < 60; idx++) queue.push(idx);  // push behind the pops
+  output << "; sum=" << sum << "; size=" << queue.size()
+         << "; peek=" << queue.peek() << "; contains(55)=" << queue.contains(55)
+         << "; contains(3)=" << queue.contains(3);
+
+  int item, expected = 20;
+  bool inOrder = true;
+  while (queue.try_pop(item)) inOrder = inOrder && item == expected++;
+  output << "; inOrder=" << inOrder << "; last=" << expected - 1
+         << "; empty=" << queue.empty();
+
+  // reused after being drained
+  queue.push(7);
+  output << "; again=" << queue.pop();
+
+  //! expect ----------------------------------
+  string expect =
+      "size=50; peek=0; sum=190; size=40; peek=20; contains(55)=1; "
+      "contains(3)=0; inOrder=1; last=59; empty=1; again=7";
+
+  //! remove data -----------------------------
+  queue.clear();
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
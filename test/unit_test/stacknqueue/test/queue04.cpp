@@ -0,0 +1,21 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_StackNQueue::queue04() {
+  string name = "queue04";
+  //! data ------------------------------------
+  // small segments: many are linked, drained, retired and reclaimed while
+  // other threads still run
+  SegmentedMPMCQueue<int, 8> queue;
+
+  //! expect ----------------------------------
+  string expect = "lost=0 duplicated=0 reordered=0 empty=1";
+
+  //! output ----------------------------------
+  string output = mpmcExchange(queue, 4, 4, 20000);
+
+  //! remove data -----------------------------
+  queue.clear();
+
+  //! result ----------------------------------
+  return printResult(output, expect, name);
+}
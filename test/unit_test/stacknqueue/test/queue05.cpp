@@ -0,0 +1,78 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_StackNQueue::queue05() {
+  string name = "queue05";
+  //! data ------------------------------------
+  // ArrayQueue: two pops then two pushes wrap the rear to the start of the
+  // buffer; a push into the full, wrapped buffer grows it (the front goes
+  // to slot 0, FIFO order kept); iterators, remove, reserve, clear + reuse
+  ArrayQueue<int> queue(0, 0, 4);
+  for (int item = 1; item <= 4; item++) queue.push(item);
+  queue.pop();
+  queue.pop();
+  queue.push(5);
+  queue.push(6);  // wrapped: slots [5, 6, 3, 4], front at slot 2
+
+  stringstream output;
+  output << queue.getCapacity() << " " << queue.toString() << " "
+         << queue.peek() << ";";
+  for (ArrayQueue<int>::Iterator it = queue.front(); it != queue.rear(); ++it)
+    output << " " << *it;
+
+  queue.push(7);  // full and wrapped: grows
+  output << "; " << queue.getCapacity() << " " << queue.toString();
+
+  ArrayQueue<string> words(0, 0, 4);
+  for (string word : {"a", "b", "c", "d"}) words.push(word);
+  words.pop();
+  words.pop();
+  words.push("e");
+  words.push("f");  // wrapped
+  output << "; " << words.remove("e") << words.remove("x") << " "
+         << words.toString() << " " << words.contains("f")
+         << words.contains("e");
+  for (ArrayQueue<string>::Iterator it = words.front(); it != words.rear(); ++it)
+    if (*it == "c") it.remove();  // the next one is still visited
+  output << " " << words.toString();
+
+  words.reserve(20);
+  output << "; " << words.getCapacity() << " " << words.toString();
+  ArrayQueue<string> copy(words);
+  copy.push("g");
+  ArrayQueue<string> assigned;
+  assigned = copy;
+  ArrayQueue<string> moved(std::move(assigned));
+  output << " " << copy.toString() << " " << words.size() << " "
+         << moved.toString() << " " << assigned.size();
+  assigned.push("h");  // a moved-from queue is empty and usable
+  output << " " << assigned.pop();
+
+  queue.clear();  // the buffer stays
+  output << "; " << queue.size() << queue.empty() << " " << queue.getCapacity();
+  for (int item = 10; item < 20; item++) queue.push(item);
+  for (int item = 0; item < 5; item++) queue.pop();
+  output << " " << queue.toString() << " " << queue.getCapacity();
+  queue.clear();
+  try {
+    queue.pop();
+  } catch (Underflow &e) {
+    output << " thrown";
+  }
+  try {
+    queue.peek();
+  } catch (out_of_range &e) {
+    output << " thrown";
+  }
+
+  //! expect ----------------------------------
+  string expect =
+      "4 FRONT-TO-REAR: [3, 4, 5, 6] 3; 3 4 5 6; 8 FRONT-TO-REAR: [3, 4, 5, 6, "
+      "7]; 10 FRONT-TO-REAR: [c, d, f] 10 FRONT-TO-REAR: [d, f]; 32 "
+      "FRONT-TO-REAR: [d, f] FRONT-TO-REAR: [d, f, g] 2 FRONT-TO-REAR: [d, f, "
+      "g] 0 h; 01 8 FRONT-TO-REAR: [15, 16, 17, 18, 19] 16 thrown thrown";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,59 @@
+#include <deque>
+#include <random>
+
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_StackNQueue::queue06() {
+  string name = "queue06";
+  //! data ------------------------------------
+  // ArrayQueue<string> against std::deque: random pushes (growing while
+  // wrapped), pops, removes from the middle, iteration, copies, clears
+  mt19937 gen(6);
+  ArrayQueue<string> queue(0, 0, 2);
+  deque<string> model;
+  int mismatches = 0, grownWrapped = 0;
+  for (int step = 0; step < 20000; step++) {
+    int op = gen() % 10;
+    if (op <= 4) {
+      string item = "s" + to_string(gen() % 300);
+      int capacity = queue.getCapacity();
+      queue.push(item);
+      model.push_back(item);
+      if (queue.getCapacity() != capacity && model.front() != model.back())
+        grownWrapped++;
+    } else if (op <= 7 && !model.empty()) {
+      if (queue.pop() != model.front()) mismatches++;
+      model.pop_front();
+    } else if (op == 8) {
+      string item = "s" + to_string(gen() % 300);
+      auto found = find(model.begin(), model.end(), item);
+      if (queue.remove(item) != (found != model.end())) mismatches++;
+      if (found != model.end()) model.erase(found);
+    } else if (gen() % 50 == 0) {
+      ArrayQueue<string> copy(queue);
+      queue.clear();
+      queue = copy;
+    } else if (gen() % 100 == 0) {
+      queue.clear();
+      model.clear();
+    }
+    if (queue.size() != (int)model.size()) mismatches++;
+    if (step % 500 == 0) {
+      size_t idx = 0;
+      for (ArrayQueue<string>::Iterator it = queue.front(); it != queue.rear();
+           ++it, ++idx)
+        if (idx >= model.size() || *it != model[idx]) mismatches++;
+    }
+  }
+
+  stringstream output;
+  output << mismatches << " " << (grownWrapped > 0);
+
+  //! expect ----------------------------------
+  string expect = "0 1";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
@@ -0,0 +1,53 @@
+#include "../unit_test.hpp"
+
+bool UNIT_TEST_StackNQueue::queue07() {
+  string name = "queue07";
+  //! data ------------------------------------
+  // ArrayStack: LIFO across growth, peek, iterators, remove/contains,
+  // reserve, clear + reuse, pop on an empty stack; toString and the
+  // iterators list the items bottom first, as Stack<T> does
+  ArrayStack<int> stack(0, 0, 2);
+  for (int item = 1; item <= 5; item++) stack.push(item);  // grows from 2
+
+  stringstream output;
+  output << stack.size() << " " << stack.peek() << " " << stack.toString()
+         << ";";
+  for (ArrayStack<int>::Iterator it = stack.top(); it != stack.bottom(); ++it)
+    output << " " << *it;
+  output << "; " << stack.pop() << stack.pop() << " " << stack.remove(1)
+         << stack.remove(9) << stack.contains(2) << stack.contains(1) << " "
+         << stack.toString();
+
+  stack.reserve(100);
+  int capacity = stack.getCapacity();
+  for (int item = 0; item < 90; item++) stack.push(item);
+  output << "; " << (capacity >= 100) << (stack.getCapacity() == capacity)
+         << " " << stack.size();
+  int last = 100, unordered = 0;
+  for (int idx = 0; idx < 90; idx++) {
+    int item = stack.pop();
+    if (item >= last) unordered++;
+    last = item;
+  }
+  output << " " << unordered << " " << stack.toString();
+
+  stack.clear();
+  output << "; " << stack.empty() << " " << (stack.getCapacity() == capacity);
+  stack.push(42);
+  output << " " << stack.pop();
+  try {
+    stack.pop();
+  } catch (Underflow &e) {
+    output << " thrown";
+  }
+
+  //! expect ----------------------------------
+  string expect =
+      "5 5 FROM TOP: [1, 2, 3, 4, 5]; 1 2 3 4 5; 54 1010 FROM TOP: [2, 3]; 11 "
+      "92 0 FROM TOP: [2, 3]; 1 1 42 thrown";
+
+  //! remove data -----------------------------
+
+  //! result ----------------------------------
+  return printResult(output.str(), expect, name);
+}
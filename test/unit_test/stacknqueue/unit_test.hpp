@@ -0,0 +1,153 @@
+#ifndef UNIT_TEST_StackNQueue_HPP
+#define UNIT_TEST_StackNQueue_HPP
+
+#include <atomic>
+#include <thread>
+
+#include "library.hpp"
+#include "stacknqueue/ArrayQueue.h"
+#include "stacknqueue/ArrayStack.h"
+#include "stacknqueue/MPMCQueue.h"
+
+/*
+ * mpmcExchange: nproducers threads push (producer << 20 | seq) for seq < nitems,
+ *  nconsumers threads pop until every item is received. Returns the number of
+ *  lost and duplicated items, and of items a consumer got out of their
+ *  producer's order.
+ */
+template <class Queue>
+string mpmcExchange(Queue &queue, int nproducers, int nconsumers, int nitems) {
+  int total = nproducers * nitems;
+  atomic<int> received(0);
+  vector<vector<int> > popped(nconsumers);
+  vector<thread> threads;
+  for (int p = 0; p < nproducers; p++) {
+    threads.push_back(thread([&queue, p, nitems]() {
+      for (int seq = 0; seq < nitems; seq++) queue.push((p << 20) | seq);
+    }));
+  }
+  for (int c = 0; c < nconsumers; c++) {
+    threads.push_back(thread([&, c]() {
+      int item;
+      while (received.load() < total) {
+        if (queue.try_pop(item)) {
+          popped[c].push_back(item);
+          received.fetch_add(1);
+        } else
+          std::this_thread::yield();
+      }
+    }));
+  }
+  for (thread &worker : threads) worker.join();
+
+  vector<int> seen(total, 0);
+  int reordered = 0;
+  for (vector<int> &items : popped) {
+    vector<int> last(nproducers, -1);
+    for (int item : items) {
+      int p = item >> 20, seq = item & 0xFFFFF;
+      seen[p * nitems + seq]++;
+      if (seq <= last[p]) reordered++;
+      last[p] = seq;
+    }
+  }
+  int lost = 0, duplicated = 0;
+  for (int count : seen) {
+    if (count == 0) lost++;
+    if (count > 1) duplicated += count - 1;
+  }
+  return "lost=" + to_string(lost) + " duplicated=" + to_string(duplicated) +
+         " reordered=" + to_string(reordered) +
+         " empty=" + to_string(queue.empty());
+}
+
+class UNIT_TEST_StackNQueue {
+ public:
+  UNIT_TEST_StackNQueue() {
+    // TODO unit test new
+    registerTest("queue01", &UNIT_TEST_StackNQueue::queue01);
+    registerTest("queue02", &UNIT_TEST_StackNQueue::queue02);
+    registerTest("queue03", &UNIT_TEST_StackNQueue::queue03);
+    registerTest("queue04", &UNIT_TEST_StackNQueue::queue04);
+    registerTest("queue05", &UNIT_TEST_StackNQueue::queue05);
+    registerTest("queue06", &UNIT_TEST_StackNQueue::queue06);
+    registerTest("queue07", &UNIT_TEST_StackNQueue::queue07);
+  }
+
+ private:
+  // TODO unit test new
+  bool queue01();
+  bool queue02();
+  bool queue03();
+  bool queue04();
+  bool queue05();
+  bool queue06();
+  bool queue07();
+
+ public:
+  static map<string, bool (UNIT_TEST_StackNQueue::*)()> TESTS;
+  // ANSI escape codes for colors
+  const string green = "\033[32m";
+  const string red = "\033[31m";
+  const string cyan = "\033[36m";
+  const string reset = "\033[0m";  // To reset to default color
+
+  // print result test case
+  bool printResult(string output, string expect, string name) {
+    if (expect == output) {
+      cout << green << "test " + name + " --------------- PASS" << reset
+           << "\n";
+      return true;
+    } else {
+      cout << red << "test " + name + " --------------- FAIL" << reset << "\n";
+      cout << "\texpect : " << expect << endl;
+      cout << "\toutput : " << output << endl;
+      return false;
+    }
+  }
+  // run 1 test case
+  void runTest(const std::string &name) {
+    auto it = TESTS.find(name);
+    if (it != TESTS.end()) {
+      (this->*(it->second))();
+    } else {
+      throw std::runtime_error("Test with name '" + name + "' does not exist.");
+    }
+  }
+  // run all test case
+  void runAllTests() {
+    vector<string> fails;
+    for (const auto &test : TESTS) {
+      if (!(this->*(test.second))()) {
+        fails.push_back(test.first);
+      }
+    }
+
+    cout << cyan << "\nResult -------------------------" << reset << endl;
+    // Print the results
+    if (fails.empty()) {
+      cout << green << "All tests passed!" << reset << endl;
+    } else {
+      int totalTests = TESTS.size();
+      int failedTests = fails.size();
+      int passedTests = totalTests - failedTests;
+      double passRate =
+          (totalTests > 0)
+              ? (static_cast<double>(passedTests) / totalTests) * 100.0
+              : 0.0;
+      cout << red << "Some tests failed:";
+      for (const auto &fail : fails) {
+        cout << "  " << fail;
+      }
+      cout << cyan << "\nPass rate: " << passRate << "%" << reset << endl;
+    }
+  }
+  static void registerTest(string name, bool (UNIT_TEST_StackNQueue::*function)()) {
+    if (TESTS.find(name) != TESTS.end()) {
+      throw std::runtime_error("Test with name '" + name + "' already exists.");
+    }
+    TESTS[name] = function;
+  }
+};
+
+#endif  // UNIT_TEST_StackNQueue_HPP
\ No newline at end of file